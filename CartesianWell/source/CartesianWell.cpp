@@ -4,6 +4,8 @@
 #include <BoostInterface/PropertyTree.hpp>
 #include <Utilities/Print.hpp>
 #include <Grid/GridData.hpp>
+#include <Grid/VertexElementAdjacency.hpp>
+#include <Grid/SpatialIndex.hpp>
 #include <CgnsInterface/CgnsReader/CgnsReader3D.hpp>
 #include <CgnsInterface/CgnsCreator/CgnsCreator3D.hpp>
 
@@ -31,28 +33,30 @@ int main() {
         int wellDirection = 2;
         std::string wellName("Well");
 
-        std::set<int> indices;
-        for (auto hexahedron : gridData->hexahedronConnectivity)
-            for (auto index : hexahedron)
-                if (isClose(gridData->coordinates[index], wellStart, wellDirection))
-                    indices.insert(index);
+        const VertexElementAdjacency& adjacency = getVertexElementAdjacency(*gridData);
+        auto isHexahedron = [&](GridIndex element) {return element >= adjacency.hexahedronBegin && element < adjacency.prismBegin;};
 
-        std::vector<std::pair<int, std::array<double, 3>>> vertices;
+        std::set<GridIndex> indices;
+        for (GridIndex index : getSpatialIndex(*gridData).findOnLine(wellStart, wellDirection, 1e-8))
+            if (std::any_of(adjacency.begin(index), adjacency.end(index), isHexahedron) && isClose(gridData->coordinates[index], wellStart, wellDirection))
+                indices.insert(index);
+
+        std::vector<std::pair<GridIndex, std::array<double, 3>>> vertices;
         for (auto index = indices.cbegin(); index != indices.cend(); index++)
             vertices.emplace_back(std::make_pair(*index, gridData->coordinates[*index]));
 
         std::stable_sort(vertices.begin(), vertices.end(), [=](auto a, auto b) {return a.second[wellDirection] < b.second[wellDirection];});
 
         unsigned numberOfLines = vertices.size() - 1;
-        int lineConnectivityShift = gridData->hexahedronConnectivity.size() + gridData->quadrangleConnectivity.size();
+        GridIndex lineConnectivityShift = gridData->hexahedronConnectivity.size() + gridData->quadrangleConnectivity.size();
 
         for (unsigned i = 0; i < numberOfLines; i++)
-            gridData->lineConnectivity.emplace_back(std::array<int, 3>{vertices[i].first, vertices[i+1].first, int(i) + lineConnectivityShift});
+            gridData->lineConnectivity.emplace_back(std::array<GridIndex, 3>{vertices[i].first, vertices[i+1].first, GridIndex(i) + lineConnectivityShift});
 
         WellData well;
         well.name = wellName;
-        well.linesOnWell.resize(numberOfLines);
-        std::iota(well.linesOnWell.begin(), well.linesOnWell.end(), lineConnectivityShift);
+        well.lineBegin = lineConnectivityShift;
+        well.lineEnd = lineConnectivityShift + numberOfLines;
         for (auto vertex : vertices)
             well.vertices.emplace_back(vertex.first);
         gridData->wells.emplace_back(std::move(well));
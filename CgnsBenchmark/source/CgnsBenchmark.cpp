@@ -0,0 +1,96 @@
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <limits>
+#include <BoostInterface/Filesystem.hpp>
+#include <Grid/GridData.hpp>
+#include <MshInterface/MshReader/MshReader3D.hpp>
+#include <CgnsInterface/CgnsReader/CgnsReader2D.hpp>
+#include <CgnsInterface/CgnsReader/CgnsReader3D.hpp>
+#include <CgnsInterface/CgnsCreator/CgnsCreator2D.hpp>
+#include <CgnsInterface/CgnsCreator/CgnsCreator3D.hpp>
+
+struct Setting {
+    std::string name;
+    CgnsFileOptions fileOptions;
+};
+
+struct Grid {
+    std::string path;
+    boost::shared_ptr<GridData> gridData;
+};
+
+boost::shared_ptr<GridData> readGrid(const boost::filesystem::path& path) {
+    if (path.extension() == std::string(".msh"))
+        return MshReader3D(path.string()).gridData;
+    else if (path.extension() == std::string(".cgns"))
+        return CgnsReader3D(path.string()).gridData;
+    else
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - file extension " + path.extension().string() + " not supported");
+}
+
+// Best of a few runs, so that small grids are not dominated by a cold cache
+template<typename Function>
+double timeBest(int runs, Function&& function) {
+    double best = std::numeric_limits<double>::max();
+    for (int run = 0; run < runs; run++) {
+        auto start = std::chrono::steady_clock::now();
+        function();
+        std::chrono::duration<double> elapsedSeconds = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsedSeconds.count());
+    }
+    return best;
+}
+
+// Writes every grid with each backend and compression level, and reports the file size and the write and read times.
+// The grids given as arguments are read as 3D .msh or .cgns files; without arguments the test grids are used.
+int main(int argc, char** argv) {
+    const int runs = 3;
+    std::vector<Grid> grids;
+    if (argc > 1) {
+        for (int i = 1; i < argc; i++)
+            grids.emplace_back(Grid{argv[i], readGrid(argv[i])});
+    }
+    else {
+        std::string testDirectory = std::string(TEST_INPUT_DIRECTORY) + "CgnsInterface/";
+        grids.emplace_back(Grid{testDirectory + "2D-Region4-ElementType1/11v_10e.cgns", CgnsReader2D(testDirectory + "2D-Region4-ElementType1/11v_10e.cgns").gridData});
+        for (std::string path : {"3D-Region1-Tetrahedra/14v_24e.cgns", "3D-Region1-Mixed/12523v_57072e.cgns"})
+            grids.emplace_back(Grid{testDirectory + path, readGrid(testDirectory + path)});
+    }
+
+    std::vector<Setting> settings{{"adf", {CgnsBackend::adf, 0}}, {"hdf5", {CgnsBackend::hdf5, 0}}};
+    for (int compressionLevel : {1, 4, 9})
+        settings.emplace_back(Setting{"hdf5 deflate " + std::to_string(compressionLevel), {CgnsBackend::hdf5, compressionLevel}});
+
+    std::string outputPath = (boost::filesystem::temp_directory_path() / "CgnsBenchmark.cgns").string();
+    for (const auto& grid : grids) {
+        std::cout << std::endl << "\tGrid path: " << grid.path;
+        std::cout << std::endl << "\t" << std::left << std::setw(16) << "setting" << std::right << std::setw(14) << "size (bytes)" << std::setw(12) << "write (s)" << std::setw(12) << "read (s)" << std::endl;
+
+        for (const auto& setting : settings) {
+            std::cout << "\t" << std::left << std::setw(16) << setting.name << std::right;
+            try {
+                double writeTime = timeBest(runs, [&]() {
+                    if (grid.gridData->dimension == 2)
+                        CgnsCreator2D creator(grid.gridData, outputPath, 0, setting.fileOptions);
+                    else
+                        CgnsCreator3D creator(grid.gridData, outputPath, false, 0, setting.fileOptions);
+                });
+                double readTime = timeBest(runs, [&]() {
+                    if (grid.gridData->dimension == 2)
+                        CgnsReader2D reader(outputPath);
+                    else
+                        CgnsReader3D reader(outputPath);
+                });
+                std::cout << std::setw(14) << boost::filesystem::file_size(outputPath) << std::setw(12) << writeTime << std::setw(12) << readTime << std::endl;
+            }
+            catch (const std::exception& exception) {
+                std::cout << "  unavailable: " << exception.what() << std::endl;
+            }
+        }
+        deleteDirectory(outputPath);
+    }
+    std::cout << std::endl;
+
+    return 0;
+}
@@ -1,12 +1,48 @@
 #include <CgnsInterface/CgnsCreator.hpp>
 #include <cgnslib.h>
 
-CgnsCreator::CgnsCreator(boost::shared_ptr<GridData> gridData, std::string folderPath) : gridData(gridData), folderPath(folderPath), elementStart(1), elementEnd(0) {
+static_assert(std::is_same<cgsize_t, GridIndex>::value, "The CGNS library and GridData must agree on the index width, configure both with or without 64-bit indices");
+
+static ElementType_t findElementType(int dimension, int numberOfVertices) {
+    if (dimension == 3) {
+        switch (numberOfVertices) {
+            case 4: return TETRA_4;
+            case 8: return HEXA_8;
+            case 6: return PENTA_6;
+            case 5: return PYRA_5;
+        }
+    }
+    else if (dimension == 2) {
+        switch (numberOfVertices) {
+            case 3: return TRI_3;
+            case 4: return QUAD_4;
+        }
+    }
+    else if (dimension == 1 && numberOfVertices == 2)
+        return BAR_2;
+
+    throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Element type not supported");
+}
+
+static std::string findElementTypeName(ElementType_t elementType) {
+    switch (elementType) {
+        case TETRA_4: return "Tetrahedra";
+        case HEXA_8: return "Hexahedra";
+        case PENTA_6: return "Prisms";
+        case PYRA_5: return "Pyramids";
+        case TRI_3: return "Triangles";
+        case QUAD_4: return "Quadrangles";
+        default: return "Lines";
+    }
+}
+
+CgnsCreator::CgnsCreator(boost::shared_ptr<GridData> gridData, std::string folderPath) : gridData(gridData), folderPath(folderPath), elementStart(1), elementEnd(0), homogeneousSections(false), chunkSize(0), sectionView(nullptr) {
     this->baseName = "Base";
     this->zoneName = "Zone";
 }
 
 void CgnsCreator::setupFile() {
+    this->configureFile();
     boost::filesystem::path input(this->folderPath);
     if (input.extension() == std::string(".cgns")) {
         if (boost::filesystem::exists(this->folderPath))
@@ -19,14 +55,42 @@ void CgnsCreator::setupFile() {
         createDirectory(folderName);
         this->fileName = folderName + std::string("Grid.cgns");
     }
-    cg_open(this->fileName.c_str(), CG_MODE_WRITE, &this->fileIndex);
+    if (cg_open(this->fileName.c_str(), CG_MODE_WRITE, &this->fileIndex))
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not open " + this->fileName);
+}
+
+// The compression level the CGNS library holds, which it keeps for every file opened afterwards
+static int libraryCompressionLevel = 0;
+
+// The file type is set again for each file. The compression is only configured when it changes,
+// since a CGNS library built without HDF5 rejects the option even at level 0.
+void CgnsCreator::configureFile() {
+    if (this->fileOptions.compressionLevel < 0 || this->fileOptions.compressionLevel > 9)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Compression level must be between 0 and 9 and not " + std::to_string(this->fileOptions.compressionLevel));
+    if (this->fileOptions.backend == CgnsBackend::adf && this->fileOptions.compressionLevel > 0)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - ADF files can not be compressed, use the hdf5 backend or compression level 0");
+
+    int fileType = CG_FILE_NONE;
+    if (this->fileOptions.backend == CgnsBackend::hdf5)
+        fileType = CG_FILE_HDF5;
+    else if (this->fileOptions.backend == CgnsBackend::adf)
+        fileType = CG_FILE_ADF;
+
+    if (cg_set_file_type(fileType))
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The CGNS library was not built with the requested backend");
+
+    if (this->fileOptions.compressionLevel != libraryCompressionLevel) {
+        if (cg_configure(CG_CONFIG_HDF5_COMPRESS, reinterpret_cast<void*>(std::intptr_t(this->fileOptions.compressionLevel))))
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not set the HDF5 compression level, the CGNS library must be built with HDF5");
+        libraryCompressionLevel = this->fileOptions.compressionLevel;
+    }
 }
 
 void CgnsCreator::initialize() {
     this->writeBase();
     this->writeZone();
     this->writeCoordinates();
-    this->buildGlobalConnectivities();
+    this->buildSections();
     this->writeSections();
     this->writeBoundaryConditions();
 }
@@ -41,14 +105,213 @@ void CgnsCreator::writeZone() {
         throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not write zone");
 }
 
+// Without a chunk size all the vertices are staged at once, in one buffer reused by every coordinate
+// Every chunk of vertices is split into coordinate arrays in a single pass over the view
+void CgnsCreator::writeCoordinateChunks(const GridDataView& view) {
+    GridIndex numberOfVertices = view.getNumberOfVertices();
+    GridIndex chunkSize = this->chunkSize > 0 ? this->chunkSize : std::max(GridIndex(1), numberOfVertices);
+
+    GridDataSoA coordinates;
+    for (GridIndex begin = 0; begin < numberOfVertices; begin += chunkSize) {
+        gatherCoordinates(begin, std::min(numberOfVertices, begin + chunkSize), [&](GridIndex vertex) -> const std::array<double, 3>& {return view.getCoordinate(vertex);}, coordinates);
+        this->writeCoordinateArrays(coordinates, begin);
+    }
+}
+
+// The coordinate arrays hold the vertices from begin on. Arrays holding every vertex are written at once, only chunks go through partial writes.
+void CgnsCreator::writeCoordinateArrays(const GridDataSoA& coordinates, GridIndex begin) {
+    const std::vector<std::string> coordinateNames{"CoordinateX", "CoordinateY", "CoordinateZ"};
+    const std::vector<const std::vector<double>*> arrays{&coordinates.coordinatesX, &coordinates.coordinatesY, &coordinates.coordinatesZ};
+    cgsize_t rangeMinimum = begin + 1;
+    cgsize_t rangeMaximum = begin + coordinates.coordinatesX.size();
+    bool whole = begin == 0 && rangeMaximum == this->sizes[0];
+    for (int i = 0; i < this->physicalDimension; i++) {
+        if (whole) {
+            if (cg_coord_write(this->fileIndex, this->baseIndex, this->zoneIndex, RealDouble, coordinateNames[i].c_str(), arrays[i]->data(), &this->coordinateIndex))
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not write " + coordinateNames[i]);
+        }
+        else if (cg_coord_partial_write(this->fileIndex, this->baseIndex, this->zoneIndex, RealDouble, coordinateNames[i].c_str(), &rangeMinimum, &rangeMaximum, arrays[i]->data(), &this->coordinateIndex))
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not write " + coordinateNames[i] + " from vertex " + std::to_string(rangeMinimum));
+    }
+}
+
+// A first pass over the elements finds their sizes, which fixes the type and length of every section and where each element of a MIXED section starts.
+// Without a chunk size, the second pass then writes the vertices of every element straight to their place in the connectivity of its section.
+// With a chunk size, nothing more is held: writeSections stages every chunk of elements when it writes it.
+// With homogeneous sections every region is written as one section per element type, which needs the elements of each type to be contiguous in the region.
+void CgnsCreator::packSections(const GridDataView& view) {
+    int numberOfThreads = defaultNumberOfThreads();
+    const GridData& layout = *view.getLayout();
+    this->sectionView = &view;
+
+    this->elementSizes.assign(view.getNumberOfElements(), 0);
+    view.forEachElement([&](GridIndex element, const GridIndex*, int numberOfVertices) {
+        this->elementSizes[element] = numberOfVertices;
+    }, numberOfThreads);
+
+    this->packedSections.clear();
+    auto addSection = [&](std::string name, std::string family, int dimension, GridIndex begin, GridIndex end) {
+        this->packedSections.emplace_back(PackedSection{name, family, dimension, 0, begin, end, {}});
+    };
+
+    for (const auto& region : layout.regions) {
+        auto begin = this->elementSizes.cbegin() + region.elementBegin;
+        auto end = this->elementSizes.cbegin() + region.elementEnd;
+        if (!this->homogeneousSections || std::all_of(begin, end, [=](auto size){return size == *begin;})) {
+            addSection(region.name, this->homogeneousSections ? region.name : "", this->cellDimension, region.elementBegin, region.elementEnd);
+            continue;
+        }
+
+        std::set<std::string> names;
+        for (auto run = begin; run != end;) {
+            auto runEnd = std::find_if(run, end, [=](auto size){return size != *run;});
+            std::string name = region.name + "_" + findElementTypeName(findElementType(this->cellDimension, *run));
+            if (!names.insert(name).second)
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The elements of region " + region.name + " must be grouped by type to be written in homogeneous sections");
+
+            addSection(name, region.name, this->cellDimension, run - this->elementSizes.cbegin(), runEnd - this->elementSizes.cbegin());
+            run = runEnd;
+        }
+    }
+    for (const auto& boundary : layout.boundaries)
+        addSection(boundary.name, "", this->cellDimension - 1, boundary.facetBegin, boundary.facetEnd);
+    for (const auto& well : layout.wells)
+        addSection(well.name, "", 1, well.lineBegin, well.lineEnd);
+    int numberOfSections = this->packedSections.size();
+
+    std::vector<std::vector<GridIndex>> mixedOffsets(numberOfSections);
+    parallelFor(numberOfSections, numberOfThreads, [&](int s) {
+        auto& section = this->packedSections[s];
+        auto begin = this->elementSizes.cbegin() + section.elementBegin;
+        auto end = this->elementSizes.cbegin() + section.elementEnd;
+
+        if (std::all_of(begin, end, [=](auto size){return size == *begin;})) {
+            section.elementType = findElementType(section.dimension, begin == end ? section.dimension + 1 : *begin);
+            if (this->chunkSize == 0)
+                section.connectivities.resize(begin == end ? 0 : (end - begin) * GridIndex(*begin));
+        }
+        else {
+            section.elementType = MIXED;
+            for (auto size = begin; size != end; size++)
+                findElementType(section.dimension, *size);
+            if (this->chunkSize == 0) {
+                auto& offsets = mixedOffsets[s];
+                offsets.resize(end - begin + 1, 0);
+                for (GridIndex i = 0; i < end - begin; i++)
+                    offsets[i + 1] = offsets[i] + 1 + begin[i];
+                section.connectivities.resize(offsets.back());
+            }
+        }
+    });
+
+    // Chunks find their elements by binary search, so every connectivity must be sorted by element index as the readers leave it
+    if (this->chunkSize > 0) {
+        forEachConnectivity(*view.getParent(), [](const auto& connectivity) {
+            if (!std::is_sorted(connectivity.cbegin(), connectivity.cend(), [](const auto& a, const auto& b) {return a.back() < b.back();}))
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Chunked writes need every connectivity sorted by element index");
+        });
+        return;
+    }
+
+    std::vector<GridIndex> sectionBegins;
+    for (const auto& section : this->packedSections)
+        sectionBegins.push_back(section.elementBegin);
+
+    view.forEachElement([&](GridIndex element, const GridIndex* vertices, int numberOfVertices) {
+        int s = std::upper_bound(sectionBegins.cbegin(), sectionBegins.cend(), element) - sectionBegins.cbegin() - 1;
+        auto& section = this->packedSections[s];
+        GridIndex position = element - section.elementBegin;
+
+        GridIndex* connectivity;
+        if (section.elementType == MIXED) {
+            connectivity = &section.connectivities[mixedOffsets[s][position]];
+            *connectivity++ = findElementType(section.dimension, numberOfVertices);
+        }
+        else
+            connectivity = &section.connectivities[position * numberOfVertices];
+
+        for (int i = 0; i < numberOfVertices; i++)
+            connectivity[i] = view.getLocalVertex(vertices[i]) + 1;
+    }, numberOfThreads);
+}
+
+// Stages the connectivity of the elements [begin, end) of a section, found in every parent connectivity by binary search on the element index
+void CgnsCreator::stageElements(const PackedSection& section, GridIndex begin, GridIndex end, std::vector<GridIndex>& staging) const {
+    const GridDataView& view = *this->sectionView;
+    bool mixed = section.elementType == MIXED;
+
+    std::vector<GridIndex> offsets(end - begin + 1, 0);
+    for (GridIndex element = begin; element < end; element++)
+        offsets[element - begin + 1] = offsets[element - begin] + this->elementSizes[element] + (mixed ? 1 : 0);
+    staging.resize(offsets.back());
+
+    GridIndex parentBegin = view.getParentElement(begin);
+    GridIndex parentEnd = parentBegin + (end - begin);
+    forEachConnectivity(*view.getParent(), [&](const auto& connectivity) {
+        auto element = std::lower_bound(connectivity.cbegin(), connectivity.cend(), parentBegin, [](const auto& e, GridIndex index) {return e.back() < index;});
+        for (; element != connectivity.cend() && element->back() < parentEnd; element++) {
+            int numberOfVertices = element->size() - 1;
+            GridIndex* vertices = &staging[offsets[element->back() - parentBegin]];
+            if (mixed)
+                *vertices++ = findElementType(section.dimension, numberOfVertices);
+            for (int i = 0; i < numberOfVertices; i++)
+                vertices[i] = view.getLocalVertex((*element)[i]) + 1;
+        }
+    });
+}
+
 void CgnsCreator::writeSections() {
-    this->writeRegions();
-    this->writeBoundaries();
+    std::set<std::string> families;
+    std::vector<GridIndex> staging;
+    for (auto& section : this->packedSections) {
+        if (!section.family.empty() && families.insert(section.family).second) {
+            int familyIndex;
+            if (cg_family_write(this->fileIndex, this->baseIndex, section.family.c_str(), &familyIndex))
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not write family " + section.family);
+        }
+
+        this->elementEnd = this->elementStart + (section.elementEnd - section.elementBegin) - 1;
+        ElementType_t elementType = ElementType_t(section.elementType);
+
+        // Whole sections, MIXED ones included, are written at once, only chunked sections go through partial writes
+        if (this->chunkSize == 0) {
+            if (cg_section_write(this->fileIndex, this->baseIndex, this->zoneIndex, section.name.c_str(), elementType, this->elementStart, this->elementEnd, this->sizes[2], section.connectivities.data(), &this->sectionIndex))
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not write section " + section.name);
+        }
+        else {
+            if (cg_section_partial_write(this->fileIndex, this->baseIndex, this->zoneIndex, section.name.c_str(), elementType, this->elementStart, this->elementEnd, this->sizes[2], &this->sectionIndex))
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not partial write section " + section.name);
+
+            for (GridIndex begin = section.elementBegin; begin < section.elementEnd; begin += this->chunkSize) {
+                GridIndex end = std::min(section.elementEnd, begin + this->chunkSize);
+                this->stageElements(section, begin, end, staging);
+
+                cgsize_t rangeMinimum = this->elementStart + begin - section.elementBegin;
+                cgsize_t rangeMaximum = this->elementStart + end - section.elementBegin - 1;
+                if (cg_elements_partial_write(this->fileIndex, this->baseIndex, this->zoneIndex, this->sectionIndex, rangeMinimum, rangeMaximum, staging.data()))
+                    throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not write element " + std::to_string(rangeMinimum) + " in section " + section.name);
+            }
+        }
+
+        if (!section.family.empty()) {
+            if (cg_goto(this->fileIndex, this->baseIndex, "Zone_t", this->zoneIndex, "Elements_t", this->sectionIndex, nullptr))
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not go to section " + section.name);
+
+            if (cg_famname_write(section.family.c_str()))
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not write section " + section.name + " family name");
+        }
+
+        this->elementStart = this->elementEnd + 1;
+        std::vector<GridIndex>().swap(section.connectivities);
+    }
+    this->packedSections.clear();
+    std::vector<unsigned char>().swap(this->elementSizes);
+    this->sectionView = nullptr;
 }
 
 void CgnsCreator::writeBoundaryConditions() {
     for (auto boundary = this->gridData->boundaries.cbegin(); boundary != this->gridData->boundaries.cend(); boundary++) {
-        std::vector<int> indices;
+        std::vector<cgsize_t> indices;
         std::transform(boundary->vertices.cbegin(), boundary->vertices.cend(), std::back_inserter(indices), [](auto x){return x + 1;});
 
         if (cg_boco_write(this->fileIndex, this->baseIndex, this->zoneIndex, boundary->name.c_str(), BCWall, PointList, indices.size(), &indices[0], &this->boundaryIndex))
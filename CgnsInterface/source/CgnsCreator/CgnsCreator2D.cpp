@@ -1,7 +1,9 @@
 #include <CgnsInterface/CgnsCreator/CgnsCreator2D.hpp>
 #include <cgnslib.h>
 
-CgnsCreator2D::CgnsCreator2D(boost::shared_ptr<GridData> gridData, std::string folderPath) : CgnsCreator(gridData, folderPath) {
+CgnsCreator2D::CgnsCreator2D(boost::shared_ptr<GridData> gridData, std::string folderPath, GridIndex chunkSize, CgnsFileOptions fileOptions) : CgnsCreator(gridData, folderPath), view(gridData) {
+    this->chunkSize = chunkSize;
+    this->fileOptions = fileOptions;
     this->checkDimension();
     this->setDimensions();
     this->setupFile();
@@ -22,108 +24,9 @@ void CgnsCreator2D::setDimensions() {
 }
 
 void CgnsCreator2D::writeCoordinates() {
-    std::vector<double> coordinatesX(this->sizes[0]);
-    std::vector<double> coordinatesY(this->sizes[0]);
-    for (int i = 0; i < this->sizes[0]; i++) {
-        coordinatesX[i] = this->gridData->coordinates[i][0];
-        coordinatesY[i] = this->gridData->coordinates[i][1];
-    }
-
-    if (cg_coord_write(this->fileIndex, this->baseIndex, this->zoneIndex, RealDouble, "CoordinateX", &coordinatesX[0], &this->coordinateIndex))
-        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not write CoordinateX");
-
-    if (cg_coord_write(this->fileIndex, this->baseIndex, this->zoneIndex, RealDouble, "CoordinateY", &coordinatesY[0], &this->coordinateIndex))
-        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not write CoordinateY");
-}
-
-void CgnsCreator2D::buildGlobalConnectivities() {
-    for (auto i = this->gridData->triangleConnectivity.cbegin(); i != this->gridData->triangleConnectivity.cend(); i++) {
-        this->globalConnectivities.emplace_back(std::vector<int>());
-        std::transform(i->cbegin(), i->cend(), std::back_inserter(this->globalConnectivities.back()), [](auto x){return x + 1;});
-    }
-    for (auto i = this->gridData->quadrangleConnectivity.cbegin(); i != this->gridData->quadrangleConnectivity.cend(); i++) {
-        this->globalConnectivities.emplace_back(std::vector<int>());
-        std::transform(i->cbegin(), i->cend(), std::back_inserter(this->globalConnectivities.back()), [](auto x){return x + 1;});
-    }
-
-    for (auto i = this->gridData->lineConnectivity.cbegin(); i != this->gridData->lineConnectivity.cend(); i++) {
-        this->globalConnectivities.emplace_back(std::vector<int>());
-        std::transform(i->cbegin(), i->cend(), std::back_inserter(this->globalConnectivities.back()), [](auto x){return x + 1;});
-    }
-
-    std::stable_sort(this->globalConnectivities.begin(), this->globalConnectivities.end(), [](const auto& a, const auto& b) {return a.back() < b.back();});
-
-    for (unsigned i = 0; i < this->globalConnectivities.size(); i++)
-        this->globalConnectivities[i].pop_back();
-}
-
-void CgnsCreator2D::writeRegions() {
-    for (auto region = this->gridData->regions.cbegin(); region != this->gridData->regions.cend(); region++) {
-
-        auto regionBegin = this->globalConnectivities.begin() + region->elementBegin;
-        auto regionEnd = this->globalConnectivities.begin() + region->elementEnd;
-        this->elementEnd += (regionEnd - regionBegin);
-
-        ElementType_t elementType;
-        if (std::all_of(regionBegin, regionEnd, [](const auto& connectivity){return connectivity.size() == 3u;}))
-            elementType = TRI_3;
-        else if (std::all_of(regionBegin, regionEnd, [](const auto& connectivity){return connectivity.size() == 4u;}))
-            elementType = QUAD_4;
-        else
-            elementType = MIXED;
-
-        if (elementType != MIXED) {
-            std::vector<int> connectivities;
-            append(regionBegin, regionEnd, std::back_inserter(connectivities));
-
-            if (cg_section_write(this->fileIndex, this->baseIndex, this->zoneIndex, region->name.c_str(), elementType, this->elementStart, this->elementEnd, sizes[2], &connectivities[0], &this->sectionIndex))
-                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not write element section " + std::to_string(this->sectionIndex));
-
-            this->elementStart = this->elementEnd + 1;
-        }
-        else {
-            if (cg_section_partial_write(this->fileIndex, this->baseIndex, this->zoneIndex, region->name.c_str(), elementType, this->elementStart, this->elementEnd, sizes[2], &this->sectionIndex))
-                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not partial write element section " + std::to_string(this->sectionIndex));
-
-            for (auto element = regionBegin; element != regionEnd; element++) {
-                switch (element->size()) {
-                    case 3 : {
-                        element->insert(element->begin(), TRI_3);
-                        break;
-                    }
-                    case 4: {
-                        element->insert(element->begin(), QUAD_4);
-                        break;
-                    }
-                    default:
-                        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Element type not supported");
-                }
-            }
-
-            std::vector<int> connectivities;
-            append(regionBegin, regionEnd, std::back_inserter(connectivities));
-
-            if (cg_elements_partial_write(this->fileIndex, this->baseIndex, this->zoneIndex, this->sectionIndex, this->elementStart, this->elementEnd, &connectivities[0]))
-                    throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not write element " + std::to_string(this->elementStart) + " in section " + std::to_string(this->sectionIndex));
-
-            this->elementStart = this->elementEnd + 1;
-        }
-    }
+    this->writeCoordinateChunks(this->view);
 }
 
-void CgnsCreator2D::writeBoundaries() {
-    for (auto boundary = this->gridData->boundaries.cbegin(); boundary != this->gridData->boundaries.cend(); boundary++) {
-
-        auto boundaryBegin = this->globalConnectivities.cbegin() + boundary->facetBegin;
-        auto boundaryEnd = this->globalConnectivities.cbegin() + boundary->facetEnd;
-        this->elementEnd = this->elementStart + (boundaryEnd - boundaryBegin) - 1;
-
-        std::vector<int> connectivities;
-        append(boundaryBegin, boundaryEnd, std::back_inserter(connectivities));
-
-        if (cg_section_write(this->fileIndex, this->baseIndex, this->zoneIndex, boundary->name.c_str(), BAR_2, this->elementStart, this->elementEnd, this->sizes[2], &connectivities[0], &this->sectionIndex))
-            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not write facet section " + std::to_string(this->sectionIndex));
-
-        this->elementStart = this->elementEnd + 1;
-    }
+void CgnsCreator2D::buildSections() {
+    this->packSections(this->view);
 }
@@ -0,0 +1,144 @@
+#include <CgnsInterface/CgnsCreator/CgnsStreamCreator.hpp>
+#include <cgnslib.h>
+#include <thread>
+#include <Utilities/BoundedQueue.hpp>
+
+CgnsStreamCreator::CgnsStreamCreator(boost::shared_ptr<GridStream> gridStream, std::string folderPath, CgnsFileOptions fileOptions) : CgnsCreator(gridStream->getGridData(), folderPath), gridStream(gridStream) {
+    this->fileOptions = fileOptions;
+    this->checkDimension();
+    this->setDimensions();
+    this->setupFile();
+    this->initialize();
+}
+
+void CgnsStreamCreator::checkDimension() {
+    if (this->gridData->dimension != 2 && this->gridData->dimension != 3)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - gridData dimension must be either 2 or 3 and not " + std::to_string(this->gridData->dimension));
+}
+
+void CgnsStreamCreator::setDimensions() {
+    this->physicalDimension = this->gridData->dimension;
+    this->cellDimension = this->gridData->dimension;
+    this->sizes[0] = this->gridStream->getNumberOfVertices();
+    this->sizes[1] = 0;
+    for (const auto& region : this->gridData->regions)
+        this->sizes[1] += region.elementEnd - region.elementBegin;
+    this->sizes[2] = 0;
+}
+
+void CgnsStreamCreator::writeCoordinates() {
+    GridDataSoA coordinates;
+    this->gridStream->streamCoordinates([&](const CoordinateChunk& chunk) {
+        gatherCoordinates(0, chunk.coordinates.size(), [&](GridIndex vertex) -> const std::array<double, 3>& {return chunk.coordinates[vertex];}, coordinates);
+        this->writeCoordinateArrays(coordinates, chunk.begin);
+    });
+}
+
+// The connectivities are never gathered: writeSections writes every chunk as soon as the grid stream hands it out
+void CgnsStreamCreator::buildSections() {}
+
+// The connectivities of a chunk as they are written, packed on their own thread
+struct PackedChunk {
+    int section;
+    GridIndex begin;
+    GridIndex end;
+    std::vector<cgsize_t> connectivities;
+};
+
+// A packing thread turns every chunk from the grid stream into CGNS connectivities while the chunk before it is written
+void CgnsStreamCreator::writeSections() {
+    this->writeRegions();
+    this->writeBoundaries();
+
+    BoundedQueue<PackedChunk> packedChunks(4);
+    std::exception_ptr exception;
+    std::thread packer([&]() {
+        try {
+            this->gridStream->streamConnectivities([&](const ConnectivityChunk& chunk) {
+                PackedChunk packed{chunk.section, chunk.begin, chunk.begin + GridIndex(chunk.sizes.size()), {}};
+                auto vertex = chunk.vertices.cbegin();
+                for (int numberOfVertices : chunk.sizes) {
+                    if (this->sectionTypes[chunk.section] == MIXED)
+                        packed.connectivities.push_back(this->findElementType(chunk.section, numberOfVertices));
+                    std::transform(vertex, vertex + numberOfVertices, std::back_inserter(packed.connectivities), [](auto x){return x + 1;});
+                    vertex += numberOfVertices;
+                }
+
+                if (!packedChunks.push(std::move(packed)))
+                    throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The sections are no longer written");
+            });
+        }
+        catch (...) {
+            exception = std::current_exception();
+        }
+        packedChunks.close();
+    });
+
+    try {
+        PackedChunk packed;
+        while (packedChunks.pop(packed)) {
+            this->elementStart = packed.begin + 1;
+            this->elementEnd = packed.end;
+            if (cg_elements_partial_write(this->fileIndex, this->baseIndex, this->zoneIndex, this->sectionIndices[packed.section], this->elementStart, this->elementEnd, &packed.connectivities[0]))
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not write element " + std::to_string(this->elementStart) + " in section " + std::to_string(this->sectionIndices[packed.section]));
+        }
+    }
+    catch (...) {
+        packedChunks.close();
+        packer.join();
+        throw;
+    }
+    packer.join();
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+void CgnsStreamCreator::writeRegions() {
+    for (unsigned i = 0; i < this->gridData->regions.size(); i++) {
+        const RegionData& region = this->gridData->regions[i];
+        this->writeSection(region.name, i, region.elementBegin, region.elementEnd);
+    }
+}
+
+void CgnsStreamCreator::writeBoundaries() {
+    for (unsigned i = 0; i < this->gridData->boundaries.size(); i++) {
+        const BoundaryData& boundary = this->gridData->boundaries[i];
+        this->writeSection(boundary.name, this->gridData->regions.size() + i, boundary.facetBegin, boundary.facetEnd);
+    }
+}
+
+// Unlike CgnsCreator, every section, MIXED ones included, is created empty and filled by partial writes: the chunks come in file order,
+// with the facets ahead of the elements, so writing a section at once with cg_section_write would mean holding its whole connectivity
+void CgnsStreamCreator::writeSection(const std::string& name, int section, GridIndex begin, GridIndex end) {
+    ElementType_t elementType = ElementType_t(this->findElementType(section, this->gridStream->getSectionElementSize(section)));
+    if (cg_section_partial_write(this->fileIndex, this->baseIndex, this->zoneIndex, name.c_str(), elementType, begin + 1, end, this->sizes[2], &this->sectionIndex))
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not partial write section " + name);
+
+    this->sectionIndices.push_back(this->sectionIndex);
+    this->sectionTypes.push_back(elementType);
+}
+
+int CgnsStreamCreator::findElementType(int section, int numberOfVertices) const {
+    bool facet = section >= int(this->gridData->regions.size());
+    if (numberOfVertices == 0)
+        return MIXED;
+
+    if (this->gridData->dimension == 3 && !facet) {
+        switch (numberOfVertices) {
+            case 4: return TETRA_4;
+            case 8: return HEXA_8;
+            case 6: return PENTA_6;
+            case 5: return PYRA_5;
+        }
+    }
+    else if (this->gridData->dimension == 3 || !facet) {
+        switch (numberOfVertices) {
+            case 3: return TRI_3;
+            case 4: return QUAD_4;
+        }
+    }
+    else if (numberOfVertices == 2)
+        return BAR_2;
+
+    throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Element type not supported");
+}
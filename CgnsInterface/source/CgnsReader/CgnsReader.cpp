@@ -1,6 +1,8 @@
 #include <CgnsInterface/CgnsReader.hpp>
 #include <cgnslib.h>
 
+static_assert(std::is_same<cgsize_t, GridIndex>::value, "The CGNS library and GridData must agree on the index width, configure both with or without 64-bit indices");
+
 CgnsReader::CgnsReader(std::string filePath) : filePath(filePath) {
     this->checkFile();
     this->readBase();
@@ -77,7 +79,24 @@ void CgnsReader::createGridData() {
     this->gridData->dimension = this->cellDimension;
 }
 
-void CgnsReader::addRegion(std::string&& name, int elementStart, int elementEnd) {
+// A region written as one section per element type is named by the family of its sections, otherwise the section names it
+std::string CgnsReader::readRegionName(int sectionIndex) {
+    if (cg_goto(this->fileIndex, this->baseIndex, "Zone_t", this->zoneIndex, "Elements_t", sectionIndex, nullptr))
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not go to section " + std::to_string(sectionIndex));
+
+    char familyName[33];
+    if (cg_famname_read(familyName) == CG_OK)
+        return familyName;
+    return this->buffer;
+}
+
+// Consecutive sections of the same region are joined back into it
+void CgnsReader::addRegion(std::string&& name, GridIndex elementStart, GridIndex elementEnd) {
+    if (!this->gridData->regions.empty() && this->gridData->regions.back().name == name && this->gridData->regions.back().elementEnd == elementStart) {
+        this->gridData->regions.back().elementEnd = elementEnd;
+        return;
+    }
+
     RegionData region;
     region.name = name;
     region.elementBegin = elementStart;
@@ -85,7 +104,7 @@ void CgnsReader::addRegion(std::string&& name, int elementStart, int elementEnd)
     this->gridData->regions.emplace_back(std::move(region));
 }
 
-void CgnsReader::addBoundary(std::string&& name, int elementStart, int elementEnd) {
+void CgnsReader::addBoundary(std::string&& name, GridIndex elementStart, GridIndex elementEnd) {
     BoundaryData boundary;
     boundary.name = name;
     boundary.facetBegin = elementStart;
@@ -97,7 +116,8 @@ void CgnsReader::readBoundaryConditions() {
     for (int boundaryIndex = 1; boundaryIndex <= this->numberOfBoundaries; boundaryIndex++) {
         BCType_t boundaryConditionType;
         PointSetType_t pointSetType;
-        int numberOfVertices, NormalIndex, NormalListSize, ndataset;
+        cgsize_t numberOfVertices, NormalListSize;
+        int NormalIndex, ndataset;
         DataType_t NormalDataType;
         if (cg_boco_info(this->fileIndex, this->baseIndex, this->zoneIndex, boundaryIndex, this->buffer, &boundaryConditionType, &pointSetType, &numberOfVertices, &NormalIndex, &NormalListSize, &NormalDataType, &ndataset))
             throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read boundary information");
@@ -110,7 +130,7 @@ void CgnsReader::readBoundaryConditions() {
 
         auto boundary = std::find_if(this->gridData->boundaries.begin(), this->gridData->boundaries.end(), [this](auto b){return b.name == std::string(this->buffer);});
         if (boundary != this->gridData->boundaries.end()) {
-            std::vector<int> vertices(numberOfVertices);
+            std::vector<cgsize_t> vertices(numberOfVertices);
             if (cg_boco_read(this->fileIndex, this->baseIndex, this->zoneIndex, boundaryIndex, &vertices[0], nullptr))
                 throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read boundary condition" + std::to_string(boundaryIndex));
 
@@ -138,11 +158,12 @@ int CgnsReader::readSolutionIndex(std::string solutionName) {
 }
 
 std::vector<double> CgnsReader::readField(int solutionIndex, std::string fieldName) {
-    int dataDimension, solutionEnd;
+    int dataDimension;
+    cgsize_t solutionEnd;
     if (cg_sol_size(this->fileIndex, this->baseIndex, this->zoneIndex, solutionIndex, &dataDimension, &solutionEnd))
         throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read solution " + std::to_string(solutionIndex));
 
-    int solutionStart = 1;
+    cgsize_t solutionStart = 1;
     std::vector<double> field(solutionEnd);
     if (cg_field_read(this->fileIndex, this->baseIndex, this->zoneIndex, solutionIndex, fieldName.c_str(), RealDouble, &solutionStart, &solutionEnd, &field[0]))
         throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read permanent field '" + fieldName + "'' in solution " + std::to_string(solutionIndex));
@@ -168,7 +189,8 @@ std::vector<double> CgnsReader::readTimeInstants() {
 
     int arrayIndex = 1;
     DataType_t dataType;
-    int dataDimension, dimensionVector;
+    int dataDimension;
+    cgsize_t dimensionVector;
     if (cg_array_info(arrayIndex, this->buffer, &dataType, &dataDimension, &dimensionVector))
         throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read array information");
 
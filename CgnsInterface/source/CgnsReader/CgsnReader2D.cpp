@@ -10,7 +10,7 @@ CgnsReader2D::CgnsReader2D(std::string filePath, bool readInConstructor) : CgnsR
 }
 
 void CgnsReader2D::readCoordinates() {
-    int one = 1;
+    cgsize_t one = 1;
 
     std::vector<double> coordinatesX(this->sizes[0]);
     if (cg_coord_read(this->fileIndex, this->baseIndex, this->zoneIndex, "CoordinateX", RealDouble, &one, this->sizes, &coordinatesX[0]))
@@ -21,7 +21,7 @@ void CgnsReader2D::readCoordinates() {
         throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read CoordinateY");
 
     this->gridData->coordinates.resize(this->sizes[0], std::array<double, 3>());
-    for (int i = 0; i < this->sizes[0]; i++) {
+    for (GridIndex i = 0; i < this->sizes[0]; i++) {
         this->gridData->coordinates[i][0] = coordinatesX[i];
         this->gridData->coordinates[i][1] = coordinatesY[i];
     }
@@ -30,7 +30,7 @@ void CgnsReader2D::readCoordinates() {
 void CgnsReader2D::readSections() {
     for (int sectionIndex = 1; sectionIndex <= this->numberOfSections; sectionIndex++) {
         ElementType_t elementType;
-        int elementStart, elementEnd;
+        cgsize_t elementStart, elementEnd;
         int lastBoundaryElement, parentFlag;
         if (cg_section_read(this->fileIndex, this->baseIndex, this->zoneIndex, sectionIndex, this->buffer, &elementType, &elementStart, &elementEnd, &lastBoundaryElement, &parentFlag))
             throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read section");
@@ -40,11 +40,11 @@ void CgnsReader2D::readSections() {
         else if (elementType == BAR_2)
             this->addBoundary(std::string(this->buffer), elementStart - 1, elementEnd);
 
-        int size;
+        cgsize_t size;
         if (cg_ElementDataSize(this->fileIndex, this->baseIndex, this->zoneIndex, sectionIndex, &size))
             throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read element data size");
 
-        std::vector<int> connectivities(size);
+        std::vector<cgsize_t> connectivities(size);
         if (cg_elements_read(this->fileIndex, this->baseIndex, this->zoneIndex, sectionIndex, &connectivities[0], nullptr))
             throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read section elements");
 
@@ -52,26 +52,26 @@ void CgnsReader2D::readSections() {
         if (cg_npe(elementType, &numberOfVertices))
             throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read element number of vertices");
 
-        int numberOfElements = elementEnd - elementStart + 1;
+        cgsize_t numberOfElements = elementEnd - elementStart + 1;
 
         switch (elementType) {
             case MIXED : {
-                int position = 0;
-                for (int e = 0; e < numberOfElements; e++) {
+                cgsize_t position = 0;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
                     cg_npe(ElementType_t(connectivities[position]), &numberOfVertices);
-                    std::vector<int> element(numberOfVertices);
+                    std::vector<GridIndex> element(numberOfVertices);
                     for (int k = 0; k < numberOfVertices; ++k)
                         element[k] = connectivities[position+1+k] - 1;
                     element.emplace_back(elementStart - 1 + e);
                     switch (connectivities[position]) {
                         case TRI_3: {
-                            std::array<int, 4> triangle;
+                            std::array<GridIndex, 4> triangle;
                             std::copy_n(std::begin(element), 4, std::begin(triangle));
                             this->gridData->triangleConnectivity.emplace_back(std::move(triangle));
                             break;
                         }
                         case QUAD_4: {
-                            std::array<int, 5> quadrangle;
+                            std::array<GridIndex, 5> quadrangle;
                             std::copy_n(std::begin(element), 5, std::begin(quadrangle));
                             this->gridData->quadrangleConnectivity.emplace_back(std::move(quadrangle));
                             break;
@@ -82,8 +82,8 @@ void CgnsReader2D::readSections() {
                 break;
             }
             case TRI_3: {
-                for (int e = 0; e < numberOfElements; e++) {
-                    std::array<int, 4> triangle;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
+                    std::array<GridIndex, 4> triangle;
                     for (int k = 0; k < numberOfVertices; k++)
                         triangle[k] = connectivities[e*numberOfVertices+k] - 1;
                     triangle.back() = elementStart - 1 + e;
@@ -92,8 +92,8 @@ void CgnsReader2D::readSections() {
                 break;
             }
             case QUAD_4: {
-                for (int e = 0; e < numberOfElements; e++) {
-                    std::array<int, 5> quadrangle;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
+                    std::array<GridIndex, 5> quadrangle;
                     for (int k = 0; k < numberOfVertices; k++)
                         quadrangle[k] = connectivities[e*numberOfVertices+k] - 1;
                     quadrangle.back() = (elementStart - 1 + e);
@@ -102,8 +102,8 @@ void CgnsReader2D::readSections() {
                 break;
             }
             case BAR_2: {
-                for (int e = 0; e < numberOfElements; e++) {
-                    std::array<int, 3> line;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
+                    std::array<GridIndex, 3> line;
                     for (int k = 0; k < numberOfVertices; k++)
                         line[k] = connectivities[e*numberOfVertices+k] - 1;
                     line.back() = (elementStart - 1 + e);
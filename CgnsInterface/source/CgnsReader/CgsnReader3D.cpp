@@ -11,7 +11,7 @@ CgnsReader3D::CgnsReader3D(std::string filePath, bool readInConstructor) : CgnsR
 }
 
 void CgnsReader3D::readCoordinates() {
-    int one = 1;
+    cgsize_t one = 1;
 
     std::vector<double> coordinatesX(this->sizes[0]);
     if (cg_coord_read(this->fileIndex, this->baseIndex, this->zoneIndex, "CoordinateX", RealDouble, &one, this->sizes, &coordinatesX[0]))
@@ -26,7 +26,7 @@ void CgnsReader3D::readCoordinates() {
         throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read CoordinateZ");
 
     this->gridData->coordinates.resize(this->sizes[0], std::array<double, 3>());
-    for (int i = 0; i < this->sizes[0]; i++) {
+    for (GridIndex i = 0; i < this->sizes[0]; i++) {
         this->gridData->coordinates[i][0] = coordinatesX[i];
         this->gridData->coordinates[i][1] = coordinatesY[i];
         this->gridData->coordinates[i][2] = coordinatesZ[i];
@@ -36,26 +36,30 @@ void CgnsReader3D::readCoordinates() {
 void CgnsReader3D::readSections() {
     for (int sectionIndex = 1; sectionIndex <= this->numberOfSections; sectionIndex++) {
         ElementType_t elementType;
-        int elementStart, elementEnd;
+        cgsize_t elementStart, elementEnd;
         int lastBoundaryElement, parentFlag;
         if (cg_section_read(this->fileIndex, this->baseIndex, this->zoneIndex, sectionIndex, this->buffer, &elementType, &elementStart, &elementEnd, &lastBoundaryElement, &parentFlag))
             throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read section");
 
-        int size;
+        // Face sections written with parent data are not part of the grid
+        if (parentFlag)
+            continue;
+
+        cgsize_t size;
         if (cg_ElementDataSize(this->fileIndex, this->baseIndex, this->zoneIndex, sectionIndex, &size))
             throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read element data size");
 
-        std::vector<int> connectivities(size);
+        std::vector<cgsize_t> connectivities(size);
         if (cg_elements_read(this->fileIndex, this->baseIndex, this->zoneIndex, sectionIndex, &connectivities[0], nullptr))
             throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read section elements");
 
         if (elementType == MIXED)
             if (ElementType_t(connectivities[0]) == TETRA_4 || ElementType_t(connectivities[0]) == HEXA_8 || ElementType_t(connectivities[0]) == PENTA_6 || ElementType_t(connectivities[0]) == PYRA_5)
-                this->addRegion(std::string(this->buffer), elementStart - 1, elementEnd);
+                this->addRegion(this->readRegionName(sectionIndex), elementStart - 1, elementEnd);
             else
                 this->addBoundary(std::string(this->buffer), elementStart - 1, elementEnd);
         else if (elementType == TETRA_4 || elementType == HEXA_8 || elementType == PENTA_6 || elementType == PYRA_5)
-                this->addRegion(std::string(this->buffer), elementStart - 1, elementEnd);
+                this->addRegion(this->readRegionName(sectionIndex), elementStart - 1, elementEnd);
         else if (elementType == TRI_3 || elementType == QUAD_4)
             this->addBoundary(std::string(this->buffer), elementStart - 1, elementEnd);
         else if (elementType == BAR_2)
@@ -65,50 +69,50 @@ void CgnsReader3D::readSections() {
         if (cg_npe(elementType, &numberOfVertices))
             throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read element number of vertices");
 
-        int numberOfElements = elementEnd - elementStart + 1;
+        cgsize_t numberOfElements = elementEnd - elementStart + 1;
 
         switch (elementType) {
             case MIXED : {
-                int position = 0;
-                for (int e = 0; e < numberOfElements; e++) {
+                cgsize_t position = 0;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
                     cg_npe(ElementType_t(connectivities[position]), &numberOfVertices);
-                    std::vector<int> element(numberOfVertices);
+                    std::vector<GridIndex> element(numberOfVertices);
                     for (int k = 0; k < numberOfVertices; ++k)
                         element[k] = connectivities[position+1+k] - 1;
                     element.emplace_back(elementStart - 1 + e);
                     switch (connectivities[position]) {
                         case TETRA_4: {
-                            std::array<int, 5> tetrahedron;
+                            std::array<GridIndex, 5> tetrahedron;
                             std::copy_n(std::begin(element), 5, std::begin(tetrahedron));
                             this->gridData->tetrahedronConnectivity.emplace_back(std::move(tetrahedron));
                             break;
                         }
                         case HEXA_8: {
-                            std::array<int, 9> hexahedron;
+                            std::array<GridIndex, 9> hexahedron;
                             std::copy_n(std::begin(element), 9, std::begin(hexahedron));
                             this->gridData->hexahedronConnectivity.emplace_back(std::move(hexahedron));
                             break;
                         }
                         case PENTA_6: {
-                            std::array<int, 7> prism;
+                            std::array<GridIndex, 7> prism;
                             std::copy_n(std::begin(element), 7, std::begin(prism));
                             this->gridData->prismConnectivity.emplace_back(std::move(prism));
                             break;
                         }
                         case PYRA_5: {
-                            std::array<int, 6> pyramid;
+                            std::array<GridIndex, 6> pyramid;
                             std::copy_n(std::begin(element), 6, std::begin(pyramid));
                             this->gridData->pyramidConnectivity.emplace_back(std::move(pyramid));
                             break;
                         }
                         case TRI_3: {
-                            std::array<int, 4> triangle;
+                            std::array<GridIndex, 4> triangle;
                             std::copy_n(std::begin(element), 4, std::begin(triangle));
                             this->gridData->triangleConnectivity.emplace_back(std::move(triangle));
                             break;
                         }
                         case QUAD_4: {
-                            std::array<int, 5> quadrangle;
+                            std::array<GridIndex, 5> quadrangle;
                             std::copy_n(std::begin(element), 5, std::begin(quadrangle));
                             this->gridData->quadrangleConnectivity.emplace_back(std::move(quadrangle));
                             break;
@@ -119,8 +123,8 @@ void CgnsReader3D::readSections() {
                 break;
             }
             case TETRA_4: {
-                for (int e = 0; e < numberOfElements; e++) {
-                    std::array<int, 5> tetrahedron;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
+                    std::array<GridIndex, 5> tetrahedron;
                     for (int k = 0; k < numberOfVertices; k++)
                         tetrahedron[k] = connectivities[e*numberOfVertices+k] - 1;
                     tetrahedron.back() = (elementStart - 1 + e);
@@ -129,8 +133,8 @@ void CgnsReader3D::readSections() {
                 break;
             }
             case HEXA_8: {
-                for (int e = 0; e < numberOfElements; e++) {
-                    std::array<int, 9> hexahedron;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
+                    std::array<GridIndex, 9> hexahedron;
                     for (int k = 0; k < numberOfVertices; k++)
                         hexahedron[k] = connectivities[e*numberOfVertices+k] - 1;
                     hexahedron.back() = (elementStart - 1 + e);
@@ -139,8 +143,8 @@ void CgnsReader3D::readSections() {
                 break;
             }
             case PENTA_6: {
-                for (int e = 0; e < numberOfElements; e++) {
-                    std::array<int, 7> prism;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
+                    std::array<GridIndex, 7> prism;
                     for (int k = 0; k < numberOfVertices; k++)
                         prism[k] = connectivities[e*numberOfVertices+k] - 1;
                     prism.back() = (elementStart - 1 + e);
@@ -149,8 +153,8 @@ void CgnsReader3D::readSections() {
                 break;
             }
             case PYRA_5: {
-                for (int e = 0; e < numberOfElements; e++) {
-                    std::array<int, 6> pyramid;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
+                    std::array<GridIndex, 6> pyramid;
                     for (int k = 0; k < numberOfVertices; k++)
                         pyramid[k] = connectivities[e*numberOfVertices+k] - 1;
                     pyramid.back() = (elementStart - 1 + e);
@@ -159,8 +163,8 @@ void CgnsReader3D::readSections() {
                 break;
             }
             case TRI_3: {
-                for (int e = 0; e < numberOfElements; e++) {
-                    std::array<int, 4> triangle;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
+                    std::array<GridIndex, 4> triangle;
                     for (int k = 0; k < numberOfVertices; k++)
                         triangle[k] = connectivities[e*numberOfVertices+k] - 1;
                     triangle.back() = (elementStart - 1 + e);
@@ -169,8 +173,8 @@ void CgnsReader3D::readSections() {
                 break;
             }
             case QUAD_4: {
-                for (int e = 0; e < numberOfElements; e++) {
-                    std::array<int, 5> quadrangle;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
+                    std::array<GridIndex, 5> quadrangle;
                     for (int k = 0; k < numberOfVertices; k++)
                         quadrangle[k] = connectivities[e*numberOfVertices+k] - 1;
                     quadrangle.back() = (elementStart - 1 + e);
@@ -179,8 +183,8 @@ void CgnsReader3D::readSections() {
                 break;
             }
             case BAR_2: {
-                for (int e = 0; e < numberOfElements; e++) {
-                    std::array<int, 3> line;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
+                    std::array<GridIndex, 3> line;
                     for (int k = 0; k < numberOfVertices; k++)
                         line[k] = connectivities[e*numberOfVertices+k] - 1;
                     line.back() = (elementStart - 1 + e);
@@ -194,7 +198,7 @@ void CgnsReader3D::readSections() {
     }
 }
 
-void CgnsReader3D::addWell(std::string&& name, int elementStart, int elementEnd) {
+void CgnsReader3D::addWell(std::string&& name, GridIndex elementStart, GridIndex elementEnd) {
     WellData well;
     well.name = name;
     well.lineBegin = elementStart;
@@ -203,11 +207,9 @@ void CgnsReader3D::addWell(std::string&& name, int elementStart, int elementEnd)
 }
 
 void CgnsReader3D::findWellVertices() {
-    for (auto& well : this->gridData->wells) {
-        std::set<int> vertices;
-        for (const auto& line : this->gridData->lineConnectivity)
-            if (line.back() >= well.lineBegin && line.back() < well.lineEnd)
-                vertices.insert(line.cbegin(), line.cend() - 1);
-        well.vertices = std::vector<int>(vertices.cbegin(), vertices.cend());
-    }
+    markVertices(this->gridData->wells.size(), this->gridData->coordinates.size(), defaultNumberOfThreads(), [this](int i, VertexMarker& marker) {
+        WellData& well = this->gridData->wells[i];
+        marker.mark(this->gridData->lineConnectivity, well.lineBegin, well.lineEnd);
+        well.vertices = marker.extract();
+    });
 }
@@ -76,7 +76,7 @@ void CgnsWriter::finalizeTransient() {
     if (!this->isFinalized) {
         this->isFinalized = true;
         if (this->timeInstants.size() > 0) {
-            int numberOfTimeSteps = this->timeInstants.size();
+            cgsize_t numberOfTimeSteps = this->timeInstants.size();
             cg_biter_write(this->fileIndex, this->baseIndex, "TimeIterativeValues", this->timeInstants.size());
             cg_goto(this->fileIndex, this->baseIndex, "BaseIterativeData_t", 1, nullptr);
             cg_array_write("TimeValues", RealDouble, 1, &numberOfTimeSteps, &this->timeInstants[0]);
@@ -27,8 +27,8 @@ struct Region2_ElementType2_2D {
     int fileIndex;
     char name[100];
     ElementType_t type;
-    int elementStart;
-    int elementEnd;
+    cgsize_t elementStart;
+    cgsize_t elementEnd;
     int nbndry;
     int parent_flag;
 };
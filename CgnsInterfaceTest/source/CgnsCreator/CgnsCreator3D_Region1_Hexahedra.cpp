@@ -27,8 +27,8 @@ struct Region1_Hexahedra_3D {
     int fileIndex;
     char name[100];
     ElementType_t type;
-    int elementStart;
-    int elementEnd;
+    cgsize_t elementStart;
+    cgsize_t elementEnd;
     int nbndry;
     int parent_flag;
 };
@@ -304,3 +304,44 @@ TestCase(Top) {
 }
 
 TestSuiteEnd()
+
+struct Region1_Hexahedra_3D_FileOptions {
+    Region1_Hexahedra_3D_FileOptions() {
+        CgnsReader3D inputReader(std::string(TEST_INPUT_DIRECTORY) + "CgnsInterface/3D-Region1-Hexahedra/27v_8e.cgns");
+        this->gridData = inputReader.gridData;
+        {
+            CgnsCreator3D creator(this->gridData, "./Region1_Hexahedra_3D_Adf.cgns", false, 0, CgnsFileOptions{CgnsBackend::adf, 0});
+        }
+        {
+            CgnsCreator3D creator(this->gridData, "./Region1_Hexahedra_3D_Deflate.cgns", false, 0, CgnsFileOptions{CgnsBackend::hdf5, 6});
+        }
+    }
+
+    ~Region1_Hexahedra_3D_FileOptions() {
+        deleteDirectory("./Region1_Hexahedra_3D_Adf.cgns");
+        deleteDirectory("./Region1_Hexahedra_3D_Deflate.cgns");
+    };
+
+    boost::shared_ptr<GridData> gridData;
+};
+
+FixtureTestSuite(Generate_Region1_Hexahedra_3D_FileOptions, Region1_Hexahedra_3D_FileOptions)
+
+TestCase(BackendAndCompression) {
+    for (std::string filePath : {"./Region1_Hexahedra_3D_Adf.cgns", "./Region1_Hexahedra_3D_Deflate.cgns"}) {
+        int fileIndex, fileType;
+        cg_open(filePath.c_str(), CG_MODE_READ, &fileIndex);
+        cg_get_file_type(fileIndex, &fileType);
+        cg_close(fileIndex);
+        checkEqual(fileType, filePath == "./Region1_Hexahedra_3D_Adf.cgns" ? CG_FILE_ADF : CG_FILE_HDF5);
+
+        CgnsReader3D reader(filePath);
+        check(reader.gridData->coordinates == this->gridData->coordinates);
+        check(reader.gridData->hexahedronConnectivity == this->gridData->hexahedronConnectivity);
+    }
+
+    BOOST_CHECK_THROW(CgnsCreator3D(this->gridData, "./Region1_Hexahedra_3D_Deflate.cgns", false, 0, CgnsFileOptions{CgnsBackend::hdf5, 10}), std::runtime_error);
+    BOOST_CHECK_THROW(CgnsCreator3D(this->gridData, "./Region1_Hexahedra_3D_Adf.cgns", false, 0, CgnsFileOptions{CgnsBackend::adf, 6}), std::runtime_error);
+}
+
+TestSuiteEnd()
@@ -1,5 +1,6 @@
 #include <BoostInterface/Test.hpp>
 #include <Grid/GridData.hpp>
+#include <Grid/GridRenumbering.hpp>
 #include <MshInterface/MshReader/MshReader3D.hpp>
 #include <CgnsInterface/CgnsReader/CgnsReader3D.hpp>
 #include <CgnsInterface/CgnsCreator/CgnsCreator3D.hpp>
@@ -27,8 +28,8 @@ struct Region1_Mixed_3D {
     int fileIndex;
     char name[100];
     ElementType_t type;
-    int elementStart;
-    int elementEnd;
+    cgsize_t elementStart;
+    cgsize_t elementEnd;
     int nbndry;
     int parent_flag;
 };
@@ -105,3 +106,96 @@ TestCase(CgnsCreator3DTest) {
 }
 
 TestSuiteEnd()
+
+struct Region1_Mixed_Homogeneous_3D {
+    Region1_Mixed_Homogeneous_3D() {
+        CgnsReader3D inputReader(std::string(TEST_INPUT_DIRECTORY) + "CgnsInterface/3D-Region1-Mixed/12523v_57072e.cgns");
+        groupElementsByType(*inputReader.gridData);
+        this->regions = inputReader.gridData->regions;
+        CgnsCreator3D fileIndex3D(inputReader.gridData, "./", true);
+        this->filePath = fileIndex3D.getFileName();
+        CgnsReader3D outputReader(this->filePath);
+        this->gridData = outputReader.gridData;
+        cg_open(this->filePath.c_str(), CG_MODE_READ, &this->fileIndex);
+    }
+
+    ~Region1_Mixed_Homogeneous_3D() {
+        cg_close(this->fileIndex);
+        deleteDirectory("./12523v_57072e/");
+    };
+
+    std::string filePath;
+    boost::shared_ptr<GridData> gridData;
+    std::vector<RegionData> regions;
+    int fileIndex;
+};
+
+FixtureTestSuite(Generate_Region1_Mixed_Homogeneous_3D, Region1_Mixed_Homogeneous_3D)
+
+TestCase(HomogeneousSections) {
+    checkEqual(this->gridData->tetrahedronConnectivity.size(), 53352u);
+    checkEqual(this->gridData->hexahedronConnectivity.size(), 1848u);
+    checkEqual(this->gridData->prismConnectivity.size(), 924u);
+    checkEqual(this->gridData->pyramidConnectivity.size(), 948u);
+    checkEqual(this->gridData->boundaries.size(), 6u);
+    checkEqual(this->gridData->wells.size(), 1u);
+
+    checkEqual(this->gridData->regions.size(), this->regions.size());
+    for (unsigned i = 0; i < this->regions.size(); i++) {
+        checkEqual(this->gridData->regions[i].name, this->regions[i].name);
+        checkEqual(this->gridData->regions[i].elementBegin, this->regions[i].elementBegin);
+        checkEqual(this->gridData->regions[i].elementEnd, this->regions[i].elementEnd);
+    }
+
+    int numberOfSections;
+    cg_nsections(this->fileIndex, 1, 1, &numberOfSections);
+    cgsize_t numberOfVolumeElements = 0;
+    for (int section = 1; section <= numberOfSections; section++) {
+        char name[100];
+        ElementType_t type;
+        cgsize_t elementStart, elementEnd;
+        int nbndry, parentFlag;
+        cg_section_read(this->fileIndex, 1, 1, section, name, &type, &elementStart, &elementEnd, &nbndry, &parentFlag);
+        if (type == TETRA_4 || type == HEXA_8 || type == PENTA_6 || type == PYRA_5)
+            numberOfVolumeElements += elementEnd - elementStart + 1;
+    }
+    checkEqual(numberOfVolumeElements, 57072);
+}
+
+TestSuiteEnd()
+
+struct Region1_Mixed_Chunked_3D {
+    Region1_Mixed_Chunked_3D() {
+        CgnsReader3D inputReader(std::string(TEST_INPUT_DIRECTORY) + "CgnsInterface/3D-Region1-Mixed/12523v_57072e.cgns");
+        this->gridData = inputReader.gridData;
+        {
+            CgnsCreator3D creator(inputReader.gridData, "./Region1_Mixed_3D_Chunked.cgns", false, 1000);
+        }
+        CgnsReader3D outputReader("./Region1_Mixed_3D_Chunked.cgns");
+        this->chunked = outputReader.gridData;
+    }
+
+    ~Region1_Mixed_Chunked_3D() {
+        deleteDirectory("./Region1_Mixed_3D_Chunked.cgns");
+    };
+
+    boost::shared_ptr<GridData> gridData;
+    boost::shared_ptr<GridData> chunked;
+};
+
+FixtureTestSuite(Generate_Region1_Mixed_Chunked_3D, Region1_Mixed_Chunked_3D)
+
+TestCase(ChunkedWritesMatchTheWholeGrid) {
+    check(this->chunked->coordinates == this->gridData->coordinates);
+    check(this->chunked->tetrahedronConnectivity == this->gridData->tetrahedronConnectivity);
+    check(this->chunked->hexahedronConnectivity == this->gridData->hexahedronConnectivity);
+    check(this->chunked->prismConnectivity == this->gridData->prismConnectivity);
+    check(this->chunked->pyramidConnectivity == this->gridData->pyramidConnectivity);
+    check(this->chunked->triangleConnectivity == this->gridData->triangleConnectivity);
+    check(this->chunked->quadrangleConnectivity == this->gridData->quadrangleConnectivity);
+    check(this->chunked->lineConnectivity == this->gridData->lineConnectivity);
+    checkEqual(this->chunked->regions.size(), this->gridData->regions.size());
+    checkEqual(this->chunked->boundaries.size(), this->gridData->boundaries.size());
+}
+
+TestSuiteEnd()
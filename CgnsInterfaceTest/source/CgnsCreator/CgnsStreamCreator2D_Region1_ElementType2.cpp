@@ -0,0 +1,87 @@
+#include <BoostInterface/Test.hpp>
+#include <Grid/GridData.hpp>
+#include <MshInterface/MshReader/MshReader2D.hpp>
+#include <MshInterface/MshReader/MshStreamReader.hpp>
+#include <CgnsInterface/CgnsReader/CgnsReader2D.hpp>
+#include <CgnsInterface/CgnsCreator/CgnsCreator2D.hpp>
+#include <CgnsInterface/CgnsCreator/CgnsStreamCreator.hpp>
+#include <cgnslib.h>
+
+// The region mixes triangles and quadrangles, so its section is MIXED and written in several chunks or in a single one
+struct Region1_ElementType2_2D_Stream {
+    Region1_ElementType2_2D_Stream() {
+        std::string inputPath = std::string(TEST_INPUT_DIRECTORY) + "MshInterface/2D-Region1-ElementType2/11v_10e.msh";
+        {
+            MshReader2D mshReader(inputPath);
+            CgnsCreator2D creator(mshReader.gridData, "./Region1_ElementType2_2D.cgns");
+        }
+        {
+            CgnsStreamCreator creator(boost::make_shared<MshStreamReader>(inputPath, 2, 3, 2), "./Region1_ElementType2_2D_Stream.cgns");
+        }
+        {
+            CgnsStreamCreator creator(boost::make_shared<MshStreamReader>(inputPath, 2, 100, 2), "./Region1_ElementType2_2D_OneChunk.cgns");
+        }
+
+        CgnsReader2D reader("./Region1_ElementType2_2D.cgns");
+        this->gridData = reader.gridData;
+
+        CgnsReader2D streamReader("./Region1_ElementType2_2D_Stream.cgns");
+        this->streamed = streamReader.gridData;
+
+        CgnsReader2D oneChunkReader("./Region1_ElementType2_2D_OneChunk.cgns");
+        this->oneChunk = oneChunkReader.gridData;
+    }
+
+    ~Region1_ElementType2_2D_Stream() {
+        deleteDirectory("./Region1_ElementType2_2D.cgns");
+        deleteDirectory("./Region1_ElementType2_2D_Stream.cgns");
+        deleteDirectory("./Region1_ElementType2_2D_OneChunk.cgns");
+    };
+
+    boost::shared_ptr<GridData> gridData;
+    boost::shared_ptr<GridData> streamed;
+    boost::shared_ptr<GridData> oneChunk;
+};
+
+FixtureTestSuite(Generate_Region1_ElementType2_2D_Stream, Region1_ElementType2_2D_Stream)
+
+TestCase(Sections) {
+    int fileIndex;
+    char name[100];
+    ElementType_t type;
+    cgsize_t elementStart, elementEnd;
+    int nbndry, parent_flag;
+    cg_open("./Region1_ElementType2_2D_Stream.cgns", CG_MODE_READ, &fileIndex);
+    cg_section_read(fileIndex, 1, 1, 1, name, &type, &elementStart, &elementEnd, &nbndry, &parent_flag);
+    cg_close(fileIndex);
+    checkEqual(std::string(name), "Geometry");
+    check(type == MIXED);
+    checkEqual(elementStart, 1);
+    checkEqual(elementEnd, 10);
+}
+
+TestCase(Connectivities) {
+    for (auto streamed : {this->streamed, this->oneChunk}) {
+        check(streamed->coordinates == this->gridData->coordinates);
+        checkEqual(streamed->triangleConnectivity.size(), 8u);
+        check(streamed->triangleConnectivity == this->gridData->triangleConnectivity);
+        checkEqual(streamed->quadrangleConnectivity.size(), 2u);
+        check(streamed->quadrangleConnectivity == this->gridData->quadrangleConnectivity);
+        checkEqual(streamed->lineConnectivity.size(), 8u);
+        check(streamed->lineConnectivity == this->gridData->lineConnectivity);
+    }
+}
+
+TestCase(Boundaries) {
+    for (auto streamed : {this->streamed, this->oneChunk}) {
+        checkEqual(streamed->boundaries.size(), this->gridData->boundaries.size());
+        for (unsigned i = 0; i < this->gridData->boundaries.size(); i++) {
+            checkEqual(streamed->boundaries[i].name, this->gridData->boundaries[i].name);
+            checkEqual(streamed->boundaries[i].facetBegin, this->gridData->boundaries[i].facetBegin);
+            checkEqual(streamed->boundaries[i].facetEnd, this->gridData->boundaries[i].facetEnd);
+            check(streamed->boundaries[i].vertices == this->gridData->boundaries[i].vertices);
+        }
+    }
+}
+
+TestSuiteEnd()
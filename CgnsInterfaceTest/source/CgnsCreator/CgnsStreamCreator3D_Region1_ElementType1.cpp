@@ -0,0 +1,86 @@
+#include <BoostInterface/Test.hpp>
+#include <Grid/GridData.hpp>
+#include <Grid/PipelinedGridStream.hpp>
+#include <MshInterface/MshReader/MshReader3D.hpp>
+#include <MshInterface/MshReader/MshStreamReader.hpp>
+#include <CgnsInterface/CgnsReader/CgnsReader3D.hpp>
+#include <CgnsInterface/CgnsCreator/CgnsCreator3D.hpp>
+#include <CgnsInterface/CgnsCreator/CgnsStreamCreator.hpp>
+
+struct Region1_ElementType1_3D_Stream {
+    Region1_ElementType1_3D_Stream() {
+        std::string inputPath = std::string(TEST_INPUT_DIRECTORY) + "MshInterface/3D-Region1-ElementType1/14v_24e.msh";
+        {
+            MshReader3D mshReader(inputPath);
+            CgnsCreator3D creator(mshReader.gridData, "./Region1_ElementType1_3D.cgns");
+        }
+        {
+            CgnsStreamCreator creator(boost::make_shared<MshStreamReader>(inputPath, 3, 5, 3), "./Region1_ElementType1_3D_Stream.cgns");
+        }
+        {
+            CgnsStreamCreator creator(boost::make_shared<PipelinedGridStream>(boost::make_shared<MshStreamReader>(inputPath, 3, 5, 3), 2), "./Region1_ElementType1_3D_Pipelined.cgns");
+        }
+
+        CgnsReader3D reader("./Region1_ElementType1_3D.cgns");
+        this->gridData = reader.gridData;
+
+        CgnsReader3D streamReader("./Region1_ElementType1_3D_Stream.cgns");
+        this->streamed = streamReader.gridData;
+
+        CgnsReader3D pipelinedReader("./Region1_ElementType1_3D_Pipelined.cgns");
+        this->pipelined = pipelinedReader.gridData;
+    }
+
+    ~Region1_ElementType1_3D_Stream() {
+        deleteDirectory("./Region1_ElementType1_3D.cgns");
+        deleteDirectory("./Region1_ElementType1_3D_Stream.cgns");
+        deleteDirectory("./Region1_ElementType1_3D_Pipelined.cgns");
+    };
+
+    boost::shared_ptr<GridData> gridData;
+    boost::shared_ptr<GridData> streamed;
+    boost::shared_ptr<GridData> pipelined;
+};
+
+FixtureTestSuite(Generate_Region1_ElementType1_3D_Stream, Region1_ElementType1_3D_Stream)
+
+TestCase(Coordinates) {
+    checkEqual(this->streamed->coordinates.size(), 14u);
+    check(this->streamed->coordinates == this->gridData->coordinates);
+}
+
+TestCase(Connectivities) {
+    checkEqual(this->streamed->tetrahedronConnectivity.size(), 24u);
+    check(this->streamed->tetrahedronConnectivity == this->gridData->tetrahedronConnectivity);
+    checkEqual(this->streamed->triangleConnectivity.size(), 24u);
+    check(this->streamed->triangleConnectivity == this->gridData->triangleConnectivity);
+}
+
+TestCase(Pipelined) {
+    check(this->pipelined->coordinates == this->gridData->coordinates);
+    check(this->pipelined->tetrahedronConnectivity == this->gridData->tetrahedronConnectivity);
+    check(this->pipelined->triangleConnectivity == this->gridData->triangleConnectivity);
+    checkEqual(this->pipelined->regions.size(), this->gridData->regions.size());
+    checkEqual(this->pipelined->boundaries.size(), this->gridData->boundaries.size());
+}
+
+TestCase(Regions) {
+    checkEqual(this->streamed->regions.size(), this->gridData->regions.size());
+    for (unsigned i = 0; i < this->gridData->regions.size(); i++) {
+        checkEqual(this->streamed->regions[i].name, this->gridData->regions[i].name);
+        checkEqual(this->streamed->regions[i].elementBegin, this->gridData->regions[i].elementBegin);
+        checkEqual(this->streamed->regions[i].elementEnd, this->gridData->regions[i].elementEnd);
+    }
+}
+
+TestCase(Boundaries) {
+    checkEqual(this->streamed->boundaries.size(), this->gridData->boundaries.size());
+    for (unsigned i = 0; i < this->gridData->boundaries.size(); i++) {
+        checkEqual(this->streamed->boundaries[i].name, this->gridData->boundaries[i].name);
+        checkEqual(this->streamed->boundaries[i].facetBegin, this->gridData->boundaries[i].facetBegin);
+        checkEqual(this->streamed->boundaries[i].facetEnd, this->gridData->boundaries[i].facetEnd);
+        check(this->streamed->boundaries[i].vertices == this->gridData->boundaries[i].vertices);
+    }
+}
+
+TestSuiteEnd()
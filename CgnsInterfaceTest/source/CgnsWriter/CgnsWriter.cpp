@@ -45,7 +45,7 @@ struct CgnsWriterFixture {
     char buffer[500];
     GridLocation_t location;
     DataType_t datatype;
-    int range_min = 1, range_max = 9;
+    cgsize_t range_min = 1, range_max = 9;
     double field[9];
 };
 
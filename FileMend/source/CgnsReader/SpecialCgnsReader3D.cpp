@@ -10,11 +10,15 @@ SpecialCgnsReader3D::SpecialCgnsReader3D(std::string filePath) : CgnsReader3D(fi
 void SpecialCgnsReader3D::readSections() {
     for (int sectionIndex = 1; sectionIndex <= this->numberOfSections; sectionIndex++) {
         ElementType_t elementType;
-        int elementStart, elementEnd;
+        cgsize_t elementStart, elementEnd;
         int lastBoundaryElement, parentFlag;
         if (cg_section_read(this->fileIndex, this->baseIndex, this->zoneIndex, sectionIndex, this->buffer, &elementType, &elementStart, &elementEnd, &lastBoundaryElement, &parentFlag))
             throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read section");
 
+        // Face sections written with parent data are not part of the grid
+        if (parentFlag)
+            continue;
+
         std::string sectionName(this->buffer);
         if (sectionName.substr(sectionName.length() - 3) == "_1D")
             continue;
@@ -23,15 +27,15 @@ void SpecialCgnsReader3D::readSections() {
         if (elementType == BAR_2)
             continue;
 
-        int numberOfElements = elementEnd - elementStart + 1;
+        cgsize_t numberOfElements = elementEnd - elementStart + 1;
         elementStart = this->gridData->tetrahedronConnectivity.size() + this->gridData->hexahedronConnectivity.size() + this->gridData->prismConnectivity.size() + this->gridData->pyramidConnectivity.size() + this->gridData->triangleConnectivity.size() + this->gridData->quadrangleConnectivity.size();
         elementEnd = elementStart + numberOfElements;
 
-        int size;
+        cgsize_t size;
         if (cg_ElementDataSize(this->fileIndex, this->baseIndex, this->zoneIndex, sectionIndex, &size))
             throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read element data size");
 
-        std::vector<int> connectivities(size);
+        std::vector<cgsize_t> connectivities(size);
         if (cg_elements_read(this->fileIndex, this->baseIndex, this->zoneIndex, sectionIndex, &connectivities[0], nullptr))
             throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not read section elements");
 
@@ -51,46 +55,46 @@ void SpecialCgnsReader3D::readSections() {
 
         switch (elementType) {
             case MIXED : {
-                int position = 0;
-                for (int e = 0; e < numberOfElements; e++) {
+                cgsize_t position = 0;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
                     cg_npe(ElementType_t(connectivities[position]), &numberOfVertices);
-                    std::vector<int> element(numberOfVertices);
+                    std::vector<GridIndex> element(numberOfVertices);
                     for (int k = 0; k < numberOfVertices; ++k)
                         element[k] = connectivities[position+1+k] - 1;
                     element.emplace_back(elementStart + e);
                     switch (connectivities[position]) {
                         case TETRA_4: {
-                            std::array<int, 5> tetrahedron;
+                            std::array<GridIndex, 5> tetrahedron;
                             std::copy_n(std::begin(element), 5, std::begin(tetrahedron));
                             this->gridData->tetrahedronConnectivity.emplace_back(std::move(tetrahedron));
                             break;
                         }
                         case HEXA_8: {
-                            std::array<int, 9> hexahedron;
+                            std::array<GridIndex, 9> hexahedron;
                             std::copy_n(std::begin(element), 9, std::begin(hexahedron));
                             this->gridData->hexahedronConnectivity.emplace_back(std::move(hexahedron));
                             break;
                         }
                         case PENTA_6: {
-                            std::array<int, 7> prism;
+                            std::array<GridIndex, 7> prism;
                             std::copy_n(std::begin(element), 7, std::begin(prism));
                             this->gridData->prismConnectivity.emplace_back(std::move(prism));
                             break;
                         }
                         case PYRA_5: {
-                            std::array<int, 6> pyramid;
+                            std::array<GridIndex, 6> pyramid;
                             std::copy_n(std::begin(element), 6, std::begin(pyramid));
                             this->gridData->pyramidConnectivity.emplace_back(std::move(pyramid));
                             break;
                         }
                         case TRI_3: {
-                            std::array<int, 4> triangle;
+                            std::array<GridIndex, 4> triangle;
                             std::copy_n(std::begin(element), 4, std::begin(triangle));
                             this->gridData->triangleConnectivity.emplace_back(std::move(triangle));
                             break;
                         }
                         case QUAD_4: {
-                            std::array<int, 5> quadrangle;
+                            std::array<GridIndex, 5> quadrangle;
                             std::copy_n(std::begin(element), 5, std::begin(quadrangle));
                             this->gridData->quadrangleConnectivity.emplace_back(std::move(quadrangle));
                             break;
@@ -101,8 +105,8 @@ void SpecialCgnsReader3D::readSections() {
                 break;
             }
             case TETRA_4: {
-                for (int e = 0; e < numberOfElements; e++) {
-                    std::array<int, 5> tetrahedron;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
+                    std::array<GridIndex, 5> tetrahedron;
                     for (int k = 0; k < numberOfVertices; k++)
                         tetrahedron[k] = connectivities[e*numberOfVertices+k] - 1;
                     tetrahedron.back() = (elementStart + e);
@@ -111,8 +115,8 @@ void SpecialCgnsReader3D::readSections() {
                 break;
             }
             case HEXA_8: {
-                for (int e = 0; e < numberOfElements; e++) {
-                    std::array<int, 9> hexahedron;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
+                    std::array<GridIndex, 9> hexahedron;
                     for (int k = 0; k < numberOfVertices; k++)
                         hexahedron[k] = connectivities[e*numberOfVertices+k] - 1;
                     hexahedron.back() = (elementStart + e);
@@ -121,8 +125,8 @@ void SpecialCgnsReader3D::readSections() {
                 break;
             }
             case PENTA_6: {
-                for (int e = 0; e < numberOfElements; e++) {
-                    std::array<int, 7> prism;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
+                    std::array<GridIndex, 7> prism;
                     for (int k = 0; k < numberOfVertices; k++)
                         prism[k] = connectivities[e*numberOfVertices+k] - 1;
                     prism.back() = (elementStart + e);
@@ -131,8 +135,8 @@ void SpecialCgnsReader3D::readSections() {
                 break;
             }
             case PYRA_5: {
-                for (int e = 0; e < numberOfElements; e++) {
-                    std::array<int, 6> pyramid;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
+                    std::array<GridIndex, 6> pyramid;
                     for (int k = 0; k < numberOfVertices; k++)
                         pyramid[k] = connectivities[e*numberOfVertices+k] - 1;
                     pyramid.back() = (elementStart + e);
@@ -141,8 +145,8 @@ void SpecialCgnsReader3D::readSections() {
                 break;
             }
             case TRI_3: {
-                for (int e = 0; e < numberOfElements; e++) {
-                    std::array<int, 4> triangle;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
+                    std::array<GridIndex, 4> triangle;
                     for (int k = 0; k < numberOfVertices; k++)
                         triangle[k] = connectivities[e*numberOfVertices+k] - 1;
                     triangle.back() = (elementStart + e);
@@ -151,8 +155,8 @@ void SpecialCgnsReader3D::readSections() {
                 break;
             }
             case QUAD_4: {
-                for (int e = 0; e < numberOfElements; e++) {
-                    std::array<int, 5> quadrangle;
+                for (cgsize_t e = 0; e < numberOfElements; e++) {
+                    std::array<GridIndex, 5> quadrangle;
                     for (int k = 0; k < numberOfVertices; k++)
                         quadrangle[k] = connectivities[e*numberOfVertices+k] - 1;
                     quadrangle.back() = (elementStart + e);
@@ -93,25 +93,25 @@ void GridDataExtractor::extractRegions() {
 
             switch (element->size()) {
                 case 5: {
-                    std::array<int, 5> tetrahedron;
+                    std::array<GridIndex, 5> tetrahedron;
                     std::copy_n(element->cbegin(), 5, std::begin(tetrahedron));
                     this->extract->tetrahedronConnectivity.emplace_back(std::move(tetrahedron));
                     break;
                 }
                 case 9: {
-                    std::array<int, 9> hexahedron;
+                    std::array<GridIndex, 9> hexahedron;
                     std::copy_n(element->cbegin(), 9, std::begin(hexahedron));
                     this->extract->hexahedronConnectivity.emplace_back(std::move(hexahedron));
                     break;
                 }
                 case 7: {
-                    std::array<int, 7> prism;
+                    std::array<GridIndex, 7> prism;
                     std::copy_n(element->cbegin(), 7, std::begin(prism));
                     this->extract->prismConnectivity.emplace_back(std::move(prism));
                     break;
                 }
                 case 6: {
-                    std::array<int, 6> pyramid;
+                    std::array<GridIndex, 6> pyramid;
                     std::copy_n(element->cbegin(), 6, std::begin(pyramid));
                     this->extract->pyramidConnectivity.emplace_back(std::move(pyramid));
                     break;
@@ -135,7 +135,7 @@ void GridDataExtractor::extractBoundaries() {
             throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - There is no boundary " + name + " in gridData");
         auto boundary(*iterator);
 
-        std::vector<int> deleteIndices;
+        std::vector<GridIndex> deleteIndices;
         for (auto i = this->original->triangleConnectivity.cbegin(); i != this->original->triangleConnectivity.cend(); i++)
             if (i->back() >= boundary.facetBegin && i->back() <= boundary.facetEnd)
                 deleteIndices.emplace_back(i -  this->original->triangleConnectivity.cbegin());
@@ -162,13 +162,13 @@ void GridDataExtractor::extractBoundaries() {
 
             switch (facet->size()) {
                 case 4: {
-                    std::array<int, 4> triangle;
+                    std::array<GridIndex, 4> triangle;
                     std::copy_n(facet->cbegin(), 4, std::begin(triangle));
                     this->extract->triangleConnectivity.emplace_back(std::move(triangle));
                     break;
                 }
                 case 5: {
-                    std::array<int, 5> quadrangle;
+                    std::array<GridIndex, 5> quadrangle;
                     std::copy_n(facet->cbegin(), 5, std::begin(quadrangle));
                     this->extract->quadrangleConnectivity.emplace_back(std::move(quadrangle));
                     break;
@@ -199,7 +199,7 @@ void GridDataExtractor::extractWells() {
 
             element->push_back(this->localIndex++);
 
-            std::array<int, 3> line;
+            std::array<GridIndex, 3> line;
             std::copy_n(element->cbegin(), 3, std::begin(line));
             this->extract->lineConnectivity.emplace_back(std::move(line));
         }
@@ -217,8 +217,8 @@ void GridDataExtractor::extractVertices() {
 }
 
 void GridDataExtractor::fixIndices() {
-    std::unordered_map<int, int> originalToExtract;
-    int index = 0;
+    std::unordered_map<GridIndex, GridIndex> originalToExtract;
+    GridIndex index = 0;
     for (auto vertex : vertices)
         originalToExtract[vertex] = index++;
 
@@ -258,3 +258,26 @@ void GridDataExtractor::fixIndices() {
         for (auto& vertex : boundary.vertices)
             vertex = originalToExtract[vertex];
 }
+
+GridDataView extractView(boost::shared_ptr<GridData> original, boost::property_tree::ptree propertyTree) {
+    if (original->dimension != 3)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - original dimension must be 3 and not " + std::to_string(original->dimension));
+
+    GridDataExtractorData names;
+    for (auto region : propertyTree.get_child("regions"))
+        names.regions.emplace_back(region.second.get_value<std::string>());
+
+    for (auto boundary : propertyTree.get_child("boundaries"))
+        names.boundaries.emplace_back(boundary.second.get_value<std::string>());
+
+    for (auto well : propertyTree.get_child("wells"))
+        names.wells.emplace_back(well.second.get_value<std::string>());
+
+    return GridDataView(original, names.regions, names.boundaries, names.wells);
+}
+
+GridDataView extractView(boost::shared_ptr<GridData> original, std::string gridDataExtractorScript) {
+    boost::property_tree::ptree propertyTree;
+    boost::property_tree::read_json(gridDataExtractorScript, propertyTree);
+    return extractView(original, propertyTree);
+}
@@ -1,6 +1,17 @@
 #include <FileMend/RadialGridDataReordered.hpp>
 #include <cgnslib.h>
 
+// First element of the connectivity, stored from shift on in the adjacency, that contains the facet and was not copied yet
+template<class Connectivity, class Facet>
+static GridIndex findElement(const VertexElementAdjacency& adjacency, const Connectivity& connectivity, GridIndex shift, const std::vector<bool>& copied, const Facet& facet) {
+    for (auto element = adjacency.begin(facet[0]); element != adjacency.end(facet[0]); element++) {
+        GridIndex position = *element - shift;
+        if (position >= 0 && position < GridIndex(connectivity.size()) && !copied[position] && hasElements(connectivity[position].cbegin(), connectivity[position].cend()-1, facet.cbegin(), facet.cend()-1))
+            return position;
+    }
+    return -1;
+}
+
 RadialGridDataReordered::RadialGridDataReordered(boost::shared_ptr<GridData> gridData) : gridData(gridData) {
     this->checkGridData();
     this->defineQuantities();
@@ -74,8 +85,8 @@ void RadialGridDataReordered::createReordered() {
 }
 
 void RadialGridDataReordered::reorderBoundaries() {
-    int firstVertex = this->gridData->lineConnectivity.front()[0];
-    int lastVertex  = this->gridData->lineConnectivity.back()[1];
+    GridIndex firstVertex = this->gridData->lineConnectivity.front()[0];
+    GridIndex lastVertex  = this->gridData->lineConnectivity.back()[1];
     auto boundary = std::find_if(this->reordered->boundaries.begin(), this->reordered->boundaries.end(),
                                     [=](auto b){return !hasElement(b.vertices.cbegin(), b.vertices.cend(), firstVertex) && !hasElement(b.vertices.cbegin(), b.vertices.cend(), lastVertex);});
     std::iter_swap(this->reordered->boundaries.begin(), boundary);
@@ -88,13 +99,9 @@ void RadialGridDataReordered::reorderBoundaries() {
 }
 
 void RadialGridDataReordered::copyData() {
-    this->hexahedra = this->gridData->hexahedronConnectivity;
-    for (auto i = 0u; i < this->hexahedra.size(); i++)
-        this->hexahedra[i].back() = i;
-
-    this->prisms = this->gridData->prismConnectivity;
-    for (auto i = 0u; i < this->prisms.size(); i++)
-        this->prisms[i].back() = i;
+    this->copiedHexahedra.assign(this->gridData->hexahedronConnectivity.size(), false);
+    this->copiedPrisms.assign(this->gridData->prismConnectivity.size(), false);
+    this->addedVertices.assign(this->gridData->coordinates.size(), false);
 
     auto boundary = this->reordered->boundaries.begin() + 1;
 
@@ -108,89 +115,84 @@ void RadialGridDataReordered::copyData() {
 }
 
 void RadialGridDataReordered::reorder() {
-    this->buildFirstSection();
+    const VertexElementAdjacency& adjacency = getVertexElementAdjacency(*this->gridData);
+    this->buildFirstSection(adjacency);
     for (int segment = 0; segment < this->numberOfSegments; segment++) {
         this->vertexShift = 0;
-        for (auto triangle = this->triangles.begin(); triangle != this->triangles.end(); triangle++)
-            for (auto prism = this->prisms.begin(); prism != this->prisms.end();)
-                if (hasElements(prism->cbegin(), prism->cend()-1, triangle->cbegin(), triangle->cend()-1)) {
-                    this->addVertex((*prism)[3], segment + 1);
-                    this->addVertex((*prism)[4], segment + 1);
-                    this->addVertex((*prism)[5], segment + 1);
-                    this->updateTriangle(prism, triangle);
-                    this->copyPrism(prism);
-                    break;
-                }
-                else
-                    prism++;
+        for (auto triangle = this->triangles.begin(); triangle != this->triangles.end(); triangle++) {
+            GridIndex prism = findElement(adjacency, this->gridData->prismConnectivity, adjacency.prismBegin, this->copiedPrisms, *triangle);
+            if (prism != -1) {
+                this->addVertex(this->gridData->prismConnectivity[prism][3], segment + 1);
+                this->addVertex(this->gridData->prismConnectivity[prism][4], segment + 1);
+                this->addVertex(this->gridData->prismConnectivity[prism][5], segment + 1);
+                this->updateTriangle(prism, triangle);
+                this->copyPrism(prism);
+            }
+        }
 
-        for (auto quadrangle = this->quadrangles.begin(); quadrangle != this->quadrangles.end(); quadrangle++)
-            for (auto hexahedron = this->hexahedra.begin(); hexahedron != this->hexahedra.end();)
-                if (hasElements(hexahedron->cbegin(), hexahedron->cend()-1, quadrangle->cbegin(), quadrangle->cend()-1)) {
-                    this->addVertex((*hexahedron)[3], segment + 1);
-                    this->addVertex((*hexahedron)[2], segment + 1);
-                    this->addVertex((*hexahedron)[6], segment + 1);
-                    this->addVertex((*hexahedron)[7], segment + 1);
-                    this->updateQuadrangle(hexahedron, quadrangle);
-                    this->copyHexahedron(hexahedron);
-                    break;
-                }
-                else
-                    hexahedron++;
+        for (auto quadrangle = this->quadrangles.begin(); quadrangle != this->quadrangles.end(); quadrangle++) {
+            GridIndex hexahedron = findElement(adjacency, this->gridData->hexahedronConnectivity, adjacency.hexahedronBegin, this->copiedHexahedra, *quadrangle);
+            if (hexahedron != -1) {
+                this->addVertex(this->gridData->hexahedronConnectivity[hexahedron][3], segment + 1);
+                this->addVertex(this->gridData->hexahedronConnectivity[hexahedron][2], segment + 1);
+                this->addVertex(this->gridData->hexahedronConnectivity[hexahedron][6], segment + 1);
+                this->addVertex(this->gridData->hexahedronConnectivity[hexahedron][7], segment + 1);
+                this->updateQuadrangle(hexahedron, quadrangle);
+                this->copyHexahedron(hexahedron);
+            }
+        }
     }
 }
 
-void RadialGridDataReordered::buildFirstSection() {
-    for (auto triangle = this->triangles.begin(); triangle != this->triangles.end(); triangle++)
-        for (auto prism = this->prisms.begin(); prism != this->prisms.end();)
-            if (hasElements(prism->cbegin(), prism->cend()-1, triangle->cbegin(), triangle->cend()-1)) {
-                this->addVertex((*prism)[0], 0);
-                this->addVertex((*prism)[1], 0);
-                this->addVertex((*prism)[2], 0);
-                break;
-            }
-            else
-                prism++;
-
-    for (auto quadrangle = this->quadrangles.begin(); quadrangle != this->quadrangles.end(); quadrangle++)
-        for (auto hexahedron = this->hexahedra.begin(); hexahedron != this->hexahedra.end();)
-            if (hasElements(hexahedron->cbegin(), hexahedron->cend()-1, quadrangle->cbegin(), quadrangle->cend()-1)) {
-                this->addVertex((*hexahedron)[0], 0);
-                this->addVertex((*hexahedron)[1], 0);
-                this->addVertex((*hexahedron)[5], 0);
-                this->addVertex((*hexahedron)[4], 0);
-                break;
-            }
-            else
-                hexahedron++;
+void RadialGridDataReordered::buildFirstSection(const VertexElementAdjacency& adjacency) {
+    for (auto triangle = this->triangles.cbegin(); triangle != this->triangles.cend(); triangle++) {
+        GridIndex prism = findElement(adjacency, this->gridData->prismConnectivity, adjacency.prismBegin, this->copiedPrisms, *triangle);
+        if (prism != -1) {
+            this->addVertex(this->gridData->prismConnectivity[prism][0], 0);
+            this->addVertex(this->gridData->prismConnectivity[prism][1], 0);
+            this->addVertex(this->gridData->prismConnectivity[prism][2], 0);
+        }
+    }
+
+    for (auto quadrangle = this->quadrangles.cbegin(); quadrangle != this->quadrangles.cend(); quadrangle++) {
+        GridIndex hexahedron = findElement(adjacency, this->gridData->hexahedronConnectivity, adjacency.hexahedronBegin, this->copiedHexahedra, *quadrangle);
+        if (hexahedron != -1) {
+            this->addVertex(this->gridData->hexahedronConnectivity[hexahedron][0], 0);
+            this->addVertex(this->gridData->hexahedronConnectivity[hexahedron][1], 0);
+            this->addVertex(this->gridData->hexahedronConnectivity[hexahedron][5], 0);
+            this->addVertex(this->gridData->hexahedronConnectivity[hexahedron][4], 0);
+        }
+    }
 }
 
-void RadialGridDataReordered::addVertex(int vertex, int section) {
-    if (std::find_if(this->vertices.cbegin(), this->vertices.cend(), [=](auto vh){return vh.first == vertex;}) == this->vertices.cend())
+void RadialGridDataReordered::addVertex(GridIndex vertex, int section) {
+    if (!this->addedVertices[vertex]) {
+        this->addedVertices[vertex] = true;
         this->vertices.push_back(std::make_pair(vertex, section * this->numberOfVerticesPerSection + this->vertexShift++));
+    }
 }
 
-void RadialGridDataReordered::updateTriangle(std::vector<std::array<int, 7>>::iterator prism, std::vector<std::array<int, 4>>::iterator triangle) {
-    (*triangle)[0] = (*prism)[3];
-    (*triangle)[1] = (*prism)[4];
-    (*triangle)[2] = (*prism)[5];
+void RadialGridDataReordered::updateTriangle(GridIndex prism, std::vector<std::array<GridIndex, 4>>::iterator triangle) {
+    (*triangle)[0] = this->gridData->prismConnectivity[prism][3];
+    (*triangle)[1] = this->gridData->prismConnectivity[prism][4];
+    (*triangle)[2] = this->gridData->prismConnectivity[prism][5];
 }
 
-void RadialGridDataReordered::updateQuadrangle(std::vector<std::array<int, 9>>::iterator hexahedron, std::vector<std::array<int, 5>>::iterator quadrangle) {
-    (*quadrangle)[0] = (*hexahedron)[2];
-    (*quadrangle)[1] = (*hexahedron)[3];
-    (*quadrangle)[2] = (*hexahedron)[7];
-    (*quadrangle)[3] = (*hexahedron)[6];
+void RadialGridDataReordered::updateQuadrangle(GridIndex hexahedron, std::vector<std::array<GridIndex, 5>>::iterator quadrangle) {
+    (*quadrangle)[0] = this->gridData->hexahedronConnectivity[hexahedron][2];
+    (*quadrangle)[1] = this->gridData->hexahedronConnectivity[hexahedron][3];
+    (*quadrangle)[2] = this->gridData->hexahedronConnectivity[hexahedron][7];
+    (*quadrangle)[3] = this->gridData->hexahedronConnectivity[hexahedron][6];
 }
 
-void RadialGridDataReordered::copyPrism(std::vector<std::array<int, 7>>::iterator prism) {
-    this->reordered->prismConnectivity.push_back(this->gridData->prismConnectivity[prism->back()]);
-    prism = this->prisms.erase(prism);
+void RadialGridDataReordered::copyPrism(GridIndex prism) {
+    this->reordered->prismConnectivity.push_back(this->gridData->prismConnectivity[prism]);
+    this->copiedPrisms[prism] = true;
 }
 
-void RadialGridDataReordered::copyHexahedron(std::vector<std::array<int, 9>>::iterator hexahedron) {
-    this->reordered->hexahedronConnectivity.push_back(this->gridData->hexahedronConnectivity[hexahedron->back()]);
-    hexahedron = this->hexahedra.erase(hexahedron);
+void RadialGridDataReordered::copyHexahedron(GridIndex hexahedron) {
+    this->reordered->hexahedronConnectivity.push_back(this->gridData->hexahedronConnectivity[hexahedron]);
+    this->copiedHexahedra[hexahedron] = true;
 }
 
 void RadialGridDataReordered::copyVertices() {
@@ -200,7 +202,7 @@ void RadialGridDataReordered::copyVertices() {
 }
 
 void RadialGridDataReordered::fixVerticesIndices() {
-    std::unordered_map<int, int> originalToFinal;
+    std::unordered_map<GridIndex, GridIndex> originalToFinal;
     for (auto vertex : this->vertices)
         originalToFinal[vertex.first] = vertex.second;
 
@@ -69,7 +69,7 @@ void SegmentGridExtractor::createSegmentGrid() {
 }
 
 void SegmentGridExtractor::copyVertices() {
-    for (int vertex = 0; vertex < 2 * this->numberOfVerticesPerSection; vertex++)
+    for (GridIndex vertex = 0; vertex < 2 * this->numberOfVerticesPerSection; vertex++)
         this->segmentGrid->coordinates.emplace_back(this->gridData->coordinates[vertex]);
 }
 
@@ -142,8 +142,8 @@ void SegmentGridExtractor::fixBoundaries() {
     boundary->facetEnd = boundary->facetBegin + this->numberOfPrismsPerSegment + this->numberOfHexahedronsPerSegment;
     std::stable_sort(boundary->vertices.begin(), boundary->vertices.end());
 
-    std::unordered_map<int, int> lastToSecond;
-    int shift = 0;
+    std::unordered_map<GridIndex, GridIndex> lastToSecond;
+    GridIndex shift = 0;
     for (auto& vertex : boundary->vertices) {
         lastToSecond[vertex] = this->numberOfVerticesPerSection + shift++;
         vertex = lastToSecond[vertex];
@@ -163,5 +163,5 @@ void SegmentGridExtractor::fixBoundaries() {
 void SegmentGridExtractor::fixWell() {
     this->segmentGrid->wells[0].lineBegin = this->segmentGrid->boundaries[2].facetEnd;
     this->segmentGrid->wells[0].lineEnd = this->segmentGrid->wells[0].lineBegin + 1;
-    this->segmentGrid->wells[0].vertices = std::vector<int>{this->segmentGrid->lineConnectivity[0][0], this->segmentGrid->lineConnectivity[0][1]};
+    this->segmentGrid->wells[0].vertices = std::vector<GridIndex>{this->segmentGrid->lineConnectivity[0][0], this->segmentGrid->lineConnectivity[0][1]};
 }
@@ -0,0 +1,133 @@
+#include <FileMend/VertexMerger.hpp>
+
+VertexMerger::VertexMerger(boost::shared_ptr<GridData> gridData, std::string vertexMergerScript) : gridData(gridData) {
+    boost::property_tree::ptree propertyTree;
+    boost::property_tree::read_json(vertexMergerScript, propertyTree);
+    this->tolerance = propertyTree.get<double>("tolerance");
+    this->mergeVertices();
+}
+
+VertexMerger::VertexMerger(boost::shared_ptr<GridData> gridData, boost::property_tree::ptree propertyTree) : gridData(gridData) {
+    this->tolerance = propertyTree.get<double>("tolerance");
+    this->mergeVertices();
+}
+
+VertexMerger::VertexMerger(boost::shared_ptr<GridData> gridData, double tolerance) : gridData(gridData), tolerance(tolerance) {
+    this->mergeVertices();
+}
+
+void VertexMerger::mergeVertices() {
+    this->checkGridData();
+    this->findCoincidentVertices();
+    if (this->numberOfMergedVertices == 0)
+        return;
+    this->checkElements();
+    this->buildNewIndices();
+    this->rewriteConnectivities();
+    this->rewriteEntities();
+}
+
+void VertexMerger::checkGridData() {
+    if (this->tolerance < 0.0)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The tolerance must not be negative and not " + std::to_string(this->tolerance));
+}
+
+// Candidate pairs come from box queries on the spatial index, which holds about one vertex per cell, so the search stays linear when the tolerance is below the vertex spacing
+void VertexMerger::findCoincidentVertices() {
+    auto spatialIndex = buildSpatialIndex(this->gridData->coordinates, this->numberOfThreads);
+    GridIndex numberOfVertices = this->gridData->coordinates.size();
+    double squaredTolerance = this->tolerance * this->tolerance;
+
+    int numberOfChunks = std::max(GridIndex(1), std::min(GridIndex(this->numberOfThreads) * 4, numberOfVertices));
+    std::vector<std::vector<std::pair<GridIndex, GridIndex>>> pairs(numberOfChunks);
+    parallelFor(numberOfChunks, this->numberOfThreads, [&](int chunk) {
+        for (GridIndex vertex = long(numberOfVertices) * chunk / numberOfChunks; vertex < long(numberOfVertices) * (chunk + 1) / numberOfChunks; vertex++) {
+            const auto& coordinate = this->gridData->coordinates[vertex];
+            std::array<double, 3> lower{coordinate[0] - this->tolerance, coordinate[1] - this->tolerance, coordinate[2] - this->tolerance};
+            std::array<double, 3> upper{coordinate[0] + this->tolerance, coordinate[1] + this->tolerance, coordinate[2] + this->tolerance};
+            spatialIndex->forEachInBox(lower, upper, [&](GridIndex other, const std::array<double, 3>& otherCoordinate) {
+                if (other < vertex && SpatialIndex::squaredDistance(coordinate, otherCoordinate) <= squaredTolerance)
+                    pairs[chunk].emplace_back(other, vertex);
+            });
+        }
+    });
+
+    this->representatives.resize(numberOfVertices);
+    std::iota(this->representatives.begin(), this->representatives.end(), 0);
+    auto find = [&](GridIndex vertex) {
+        while (this->representatives[vertex] != vertex)
+            vertex = this->representatives[vertex] = this->representatives[this->representatives[vertex]];
+        return vertex;
+    };
+    for (const auto& chunk : pairs)
+        for (const auto& pair : chunk) {
+            GridIndex first = find(pair.first), second = find(pair.second);
+            if (first != second)
+                this->representatives[std::max(first, second)] = std::min(first, second);
+        }
+    for (GridIndex vertex = 0; vertex < numberOfVertices; vertex++) {
+        this->representatives[vertex] = find(vertex);
+        if (this->representatives[vertex] != vertex)
+            this->numberOfMergedVertices++;
+    }
+}
+
+// Every element is checked before the grid data is touched, so a tolerance that collapses an element leaves it unchanged
+void VertexMerger::checkElements() {
+    forEachConnectivity(*this->gridData, [&](auto& connectivity) {
+        GridIndex size = connectivity.size();
+        int numberOfChunks = std::max(GridIndex(1), std::min(GridIndex(this->numberOfThreads) * 4, size));
+        parallelFor(numberOfChunks, this->numberOfThreads, [&](int chunk) {
+            for (GridIndex i = long(size) * chunk / numberOfChunks; i < long(size) * (chunk + 1) / numberOfChunks; i++)
+                for (auto vertex = connectivity[i].cbegin() + 1; vertex != connectivity[i].cend() - 1; vertex++)
+                    for (auto previous = connectivity[i].cbegin(); previous != vertex; previous++)
+                        if (this->representatives[*previous] == this->representatives[*vertex])
+                            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Element " + std::to_string(connectivity[i].back()) + " collapses, the tolerance is larger than its edges");
+        });
+    });
+}
+
+void VertexMerger::buildNewIndices() {
+    GridIndex numberOfVertices = this->gridData->coordinates.size();
+    this->newIndices.resize(numberOfVertices);
+
+    GridIndex index = 0;
+    for (GridIndex vertex = 0; vertex < numberOfVertices; vertex++)
+        if (this->representatives[vertex] == vertex) {
+            this->gridData->coordinates[index] = this->gridData->coordinates[vertex];
+            this->newIndices[vertex] = index++;
+        }
+        else
+            this->newIndices[vertex] = this->newIndices[this->representatives[vertex]];
+
+    this->gridData->coordinates.resize(index);
+}
+
+void VertexMerger::rewriteConnectivities() {
+    forEachConnectivity(*this->gridData, [&](auto& connectivity) {
+        GridIndex size = connectivity.size();
+        int numberOfChunks = std::max(GridIndex(1), std::min(GridIndex(this->numberOfThreads) * 4, size));
+        parallelFor(numberOfChunks, this->numberOfThreads, [&](int chunk) {
+            for (GridIndex i = long(size) * chunk / numberOfChunks; i < long(size) * (chunk + 1) / numberOfChunks; i++)
+                for (auto vertex = connectivity[i].begin(); vertex != connectivity[i].end() - 1; vertex++)
+                    *vertex = this->newIndices[*vertex];
+        });
+    });
+}
+
+void VertexMerger::rewriteEntities() {
+    auto rewrite = [&](std::vector<GridIndex>& vertices) {
+        for (auto& vertex : vertices)
+            vertex = this->newIndices[vertex];
+        std::sort(vertices.begin(), vertices.end());
+        vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+    };
+
+    for (auto& boundary : this->gridData->boundaries)
+        rewrite(boundary.vertices);
+    for (auto& well : this->gridData->wells)
+        rewrite(well.vertices);
+
+    this->gridData->vertexElementAdjacency.reset();
+    this->gridData->spatialIndex.reset();
+}
@@ -42,44 +42,49 @@ void WellGenerator::generateWells() {
         this->lineConnectivityShift = this->gridData->tetrahedronConnectivity.size() + this->gridData->hexahedronConnectivity.size() + this->gridData->prismConnectivity.size()
                                         + this->gridData->pyramidConnectivity.size() + this->gridData->triangleConnectivity.size() + this->gridData->quadrangleConnectivity.size();
 
+    const VertexElementAdjacency& adjacency = getVertexElementAdjacency(*this->gridData);
+    const SpatialIndex& spatialIndex = getSpatialIndex(*this->gridData);
+
     for (auto wellGeneratorData : this->wellGeneratorDatum) {
 
         auto wellRegion = std::find_if(this->gridData->regions.cbegin(), this->gridData->regions.cend(), [=](auto r){return r.name == wellGeneratorData.regionName;});
 
+        this->wellPrisms.assign(this->gridData->prismConnectivity.size(), false);
         for (auto i = this->gridData->prismConnectivity.cbegin(); i != this->gridData->prismConnectivity.cend(); i++)
             if (i->back() >= wellRegion->elementBegin && i->back() < wellRegion->elementEnd)
-                this->prisms.emplace_back(i->cbegin(), i->cend()-1);
+                this->wellPrisms[i - this->gridData->prismConnectivity.cbegin()] = true;
+
+        this->currentIndex = -1;
+        const auto& wellStart = wellGeneratorData.wellStart;
+        for (GridIndex vertex : spatialIndex.findInBox({wellStart[0] - this->tolerance, wellStart[1] - this->tolerance, wellStart[2] - this->tolerance}, {wellStart[0] + this->tolerance, wellStart[1] + this->tolerance, wellStart[2] + this->tolerance}))
+            if (isClose(this->gridData->coordinates[vertex], wellStart) && !this->findWellPrisms(adjacency, vertex).empty())
+                this->currentIndex = vertex;
 
-        for (const auto& prism : this->prisms)
-            for (const auto& index : prism)
-                if (isClose(this->gridData->coordinates[index], wellGeneratorData.wellStart))
-                    this->currentIndex = index;
+        if (this->currentIndex == -1)
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - There is no prism vertex of region " + wellGeneratorData.regionName + " at the start of well " + wellGeneratorData.wellName);
 
-        this->defineQuantities();
+        this->defineQuantities(adjacency);
 
-        std::vector<int> vertices;
+        std::vector<GridIndex> vertices;
         vertices.push_back(this->currentIndex);
 
         for (int k = 0; k < this->numberOfSegments; k++) {
-            std::set<int> wellStartPrisms;
-            for (auto i = 0u; i < this->prisms.size(); i++)
-                if (std::find(this->prisms[i].cbegin(), this->prisms[i].cend(), this->currentIndex) != this->prisms[i].cend())
-                    wellStartPrisms.insert(i);
-
-            std::set<int> wellStartVertices;
-            for (const auto& prismIndex : wellStartPrisms)
-                wellStartVertices.insert(this->prisms[prismIndex].cbegin(), this->prisms[prismIndex].cend());
+            std::vector<GridIndex> wellStartPrisms = this->findWellPrisms(adjacency, this->currentIndex);
 
-            std::unordered_map<int, int> map;
-            for (const auto& vertexIndex : wellStartVertices)
-                for (const auto& prismIndex : wellStartPrisms)
-                    if (std::find(this->prisms[prismIndex].cbegin(), this->prisms[prismIndex].cend(), vertexIndex) != this->prisms[prismIndex].cend())
-                        map[vertexIndex]++;
+            std::unordered_map<GridIndex, int> map;
+            for (const auto& prismIndex : wellStartPrisms) {
+                const auto& prism = this->gridData->prismConnectivity[prismIndex];
+                for (auto vertex = prism.cbegin(); vertex != prism.cend() - 1; vertex++)
+                    map[*vertex]++;
+            }
 
-            this->currentIndex = std::find_if(map.cbegin(), map.cend(), [=](auto entry){return entry.first != this->currentIndex && entry.second == numberOfElementsPerSection;})->first;
+            auto next = std::find_if(map.cbegin(), map.cend(), [=](auto entry){return entry.first != this->currentIndex && entry.second == numberOfElementsPerSection;});
+            if (next == map.cend())
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not find the next vertex of well " + wellGeneratorData.wellName + " after vertex " + std::to_string(this->currentIndex));
+            this->currentIndex = next->first;
 
-            for (auto rit = wellStartPrisms.crbegin(); rit != wellStartPrisms.crend(); rit++)
-                this->prisms.erase(this->prisms.begin() + *rit);
+            for (const auto& prismIndex : wellStartPrisms)
+                this->wellPrisms[prismIndex] = false;
 
             vertices.push_back(this->currentIndex);
         }
@@ -87,7 +92,7 @@ void WellGenerator::generateWells() {
         unsigned numberOfLines = vertices.size() - 1;
 
         for (unsigned i = 0; i < numberOfLines; i++)
-            this->gridData->lineConnectivity.emplace_back(std::array<int, 3>{vertices[i], vertices[i+1], int(i) + this->lineConnectivityShift});
+            this->gridData->lineConnectivity.emplace_back(std::array<GridIndex, 3>{vertices[i], vertices[i+1], GridIndex(i) + this->lineConnectivityShift});
 
         std::stable_sort(vertices.begin(), vertices.end());
 
@@ -102,17 +107,21 @@ void WellGenerator::generateWells() {
     }
 }
 
-void WellGenerator::defineQuantities() {
-    std::set<int> wellStartPrisms;
-    for (auto i = 0u; i < this->prisms.size(); i++)
-        if (std::find(this->prisms[i].cbegin(), this->prisms[i].cend(), this->currentIndex) != this->prisms[i].cend())
-            wellStartPrisms.insert(i);
-
-    this->numberOfPrisms = this->prisms.size();
-    this->numberOfElementsPerSection = wellStartPrisms.size();
+void WellGenerator::defineQuantities(const VertexElementAdjacency& adjacency) {
+    this->numberOfPrisms = std::count(this->wellPrisms.cbegin(), this->wellPrisms.cend(), true);
+    this->numberOfElementsPerSection = this->findWellPrisms(adjacency, this->currentIndex).size();
     this->numberOfSegments = this->numberOfPrisms / this->numberOfElementsPerSection;
 }
 
+// Prisms of the well region that touch the vertex and were not walked yet
+std::vector<GridIndex> WellGenerator::findWellPrisms(const VertexElementAdjacency& adjacency, GridIndex vertex) {
+    std::vector<GridIndex> prisms;
+    for (auto element = adjacency.begin(vertex); element != adjacency.end(vertex); element++)
+        if (*element >= adjacency.prismBegin && *element < adjacency.pyramidBegin && this->wellPrisms[*element - adjacency.prismBegin])
+            prisms.push_back(*element - adjacency.prismBegin);
+    return prisms;
+}
+
 bool WellGenerator::isClose(const std::array<double, 3>& coordinate, const std::array<double, 3>& referencePoint) {
     bool close = true;
 
@@ -0,0 +1,63 @@
+#include <BoostInterface/Test.hpp>
+#include <FileMend/VertexMerger.hpp>
+
+// Two hexahedra meshed apart, so the four vertices of their common face are stored twice
+struct VertexMergerFixture {
+    VertexMergerFixture() {
+        this->gridData->dimension = 3;
+        for (int block = 0; block < 2; block++)
+            for (int k = 0; k < 2; k++)
+                for (int j = 0; j < 2; j++)
+                    for (int i = 0; i < 2; i++)
+                        this->gridData->coordinates.push_back({double(block + i) + (block && !i ? 1e-10 : 0.0), double(j), double(k)});
+
+        auto vertex = [](int block, int i, int j, int k) {return GridIndex(8 * block + i + 2 * j + 4 * k);};
+        for (int block = 0; block < 2; block++)
+            this->gridData->hexahedronConnectivity.push_back({vertex(block, 0, 0, 0), vertex(block, 1, 0, 0), vertex(block, 1, 1, 0), vertex(block, 0, 1, 0), vertex(block, 0, 0, 1), vertex(block, 1, 0, 1), vertex(block, 1, 1, 1), vertex(block, 0, 1, 1), GridIndex(block)});
+        this->gridData->quadrangleConnectivity = {{vertex(0, 0, 0, 0), vertex(0, 1, 0, 0), vertex(0, 1, 0, 1), vertex(0, 0, 0, 1), 2}, {vertex(1, 0, 0, 0), vertex(1, 1, 0, 0), vertex(1, 1, 0, 1), vertex(1, 0, 0, 1), 3}};
+        this->gridData->lineConnectivity = {{vertex(0, 1, 0, 0), vertex(1, 1, 0, 0), 4}};
+
+        this->gridData->regions = {RegionData{"Body", 0, 2}};
+        this->gridData->boundaries = {BoundaryData{"South", 2, 4, {0, 1, 4, 5, 8, 9, 12, 13}}};
+        this->gridData->wells = {WellData{"Well", 4, 5, {1, 9}}};
+    }
+
+    boost::shared_ptr<GridData> gridData = boost::make_shared<GridData>();
+};
+
+FixtureTestSuite(VertexMergerSuite, VertexMergerFixture)
+
+TestCase(VertexMergerTest) {
+    VertexMerger vertexMerger(this->gridData, 1e-6);
+
+    checkEqual(vertexMerger.numberOfMergedVertices, 4);
+    checkEqual(this->gridData->coordinates.size(), 12u);
+    checkEqual(this->gridData->coordinates[8][0], 2.0);
+
+    auto second = this->gridData->hexahedronConnectivity[1];
+    check(std::vector<GridIndex>(second.cbegin(), second.cend()) == std::vector<GridIndex>({1, 8, 9, 3, 5, 10, 11, 7, 1}));
+    checkEqual(this->gridData->quadrangleConnectivity[1][0], 1);
+    checkEqual(this->gridData->lineConnectivity[0][1], 8);
+
+    check(this->gridData->boundaries[0].vertices == std::vector<GridIndex>({0, 1, 4, 5, 8, 10}));
+    check(this->gridData->wells[0].vertices == std::vector<GridIndex>({1, 8}));
+}
+
+TestCase(VertexMergerWithoutCoincidentVertices) {
+    boost::property_tree::ptree propertyTree;
+    propertyTree.put("tolerance", 1e-12);
+    VertexMerger vertexMerger(this->gridData, propertyTree);
+
+    checkEqual(vertexMerger.numberOfMergedVertices, 0);
+    checkEqual(this->gridData->coordinates.size(), 16u);
+    checkEqual(this->gridData->hexahedronConnectivity[1][0], 8);
+}
+
+TestCase(VertexMergerRejectsCollapsingElements) {
+    auto coordinates = this->gridData->coordinates;
+    BOOST_CHECK_THROW(VertexMerger(this->gridData, 1.5), std::runtime_error);
+    check(this->gridData->coordinates == coordinates);
+    BOOST_CHECK_THROW(VertexMerger(this->gridData, -1.0), std::runtime_error);
+}
+
+TestSuiteEnd()
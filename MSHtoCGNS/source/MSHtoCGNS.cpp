@@ -5,11 +5,88 @@
 #include <BoostInterface/Filesystem.hpp>
 #include <BoostInterface/PropertyTree.hpp>
 #include <Grid/GridData.hpp>
+#include <Grid/GridFaces.hpp>
+#include <Grid/GridGeometry.hpp>
+#include <Grid/PipelinedGridStream.hpp>
+#include <Grid/GridRenumbering.hpp>
+#include <Grid/GridSnapshot.hpp>
 #include <MshInterface/Output.hpp>
 #include <MshInterface/MshReader/MshReader2D.hpp>
 #include <MshInterface/MshReader/MshReader3D.hpp>
+#include <MshInterface/MshReader/MshStreamReader.hpp>
 #include <CgnsInterface/CgnsCreator/CgnsCreator2D.hpp>
 #include <CgnsInterface/CgnsCreator/CgnsCreator3D.hpp>
+#include <CgnsInterface/CgnsCreator/CgnsStreamCreator.hpp>
+#include <CgnsInterface/CgnsWriter.hpp>
+
+// Backend and compression of the CGNS file, keeping the library defaults when the script does not set them
+CgnsFileOptions readFileOptions(const boost::property_tree::ptree& propertyTree) {
+    CgnsFileOptions fileOptions;
+    std::string backend = propertyTree.get<std::string>("write.backend", "default");
+    if (backend == "hdf5")
+        fileOptions.backend = CgnsBackend::hdf5;
+    else if (backend == "adf")
+        fileOptions.backend = CgnsBackend::adf;
+    else if (backend != "default")
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Backend must be default, hdf5 or adf and not " + backend);
+    fileOptions.compressionLevel = propertyTree.get<int>("write.compression", 0);
+    return fileOptions;
+}
+
+// Counts the grid on a first pass and then writes it chunk by chunk, so the memory does not grow with the grid size.
+// When pipelined, the chunks are parsed on their own thread while the ones before them are written.
+void convertStream(int dimension, std::string inputPath, std::string outputPath, int chunkSize, bool pipelined, CgnsFileOptions fileOptions) {
+    auto start = std::chrono::steady_clock::now();
+    boost::shared_ptr<GridStream> streamReader = boost::make_shared<MshStreamReader>(inputPath, dimension, chunkSize);
+    if (pipelined)
+        streamReader = boost::make_shared<PipelinedGridStream>(streamReader);
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsedSeconds = end - start;
+    std::cout << std::endl << "\tGrid path: " << inputPath;
+    std::cout << std::endl << "\tCounted in: " << elapsedSeconds.count() << " s" << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    CgnsStreamCreator streamCreator(streamReader, outputPath, fileOptions);
+    end = std::chrono::steady_clock::now();
+    elapsedSeconds = end - start;
+    std::cout << std::endl << "\tStreamed to CGNS format in: " << elapsedSeconds.count() << " s";
+    std::cout << std::endl << "\tOutput file location      : " << streamCreator.getFileName() << std::endl << std::endl;
+}
+
+// Reorders the vertices and the elements of every region and boundary for cache locality before they are written
+void renumber(const boost::property_tree::ptree& propertyTree, GridData& gridData) {
+    std::string vertices = propertyTree.get<std::string>("renumbering.vertices", "none");
+    std::string elements = propertyTree.get<std::string>("renumbering.elements", "none");
+    if (vertices == "none" && elements == "none")
+        return;
+
+    auto start = std::chrono::steady_clock::now();
+    if (vertices == "rcm")
+        renumberVertices(gridData, reverseCuthillMcKee(gridData));
+    else if (vertices != "none")
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Vertex renumbering must be none or rcm and not " + vertices);
+
+    if (elements == "hilbert")
+        renumberElements(gridData, SpaceFillingCurve::hilbert);
+    else if (elements == "morton")
+        renumberElements(gridData, SpaceFillingCurve::morton);
+    else if (elements != "none")
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Element renumbering must be none, hilbert or morton and not " + elements);
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsedSeconds = end - start;
+    std::cout << std::endl << "\tRenumbered in: " << elapsedSeconds.count() << " s" << std::endl;
+}
+
+// Cell volumes and centroids as a permanent cell centred solution, once the creator has closed the file
+void writeGeometry(std::string fileName, const GridData& gridData) {
+    GridGeometry geometry = computeGridGeometry(gridData);
+    CgnsWriter writer(fileName, "CellCenter");
+    writer.writePermanentSolution("Geometry");
+    writer.writePermanentField("Volume", geometry.volumes);
+    writer.writePermanentField("CentroidX", geometry.centroids[0]);
+    writer.writePermanentField("CentroidY", geometry.centroids[1]);
+    writer.writePermanentField("CentroidZ", geometry.centroids[2]);
+}
 
 int main(int argc, char** argv) {
     if (argc != 2)
@@ -23,16 +100,20 @@ int main(int argc, char** argv) {
             std::string inputPath  = propertyTree.get<std::string>("path.input");
             std::string outputPath = propertyTree.get<std::string>("path.output");
 
+            if (propertyTree.get<bool>("stream.enabled", false)) {
+                convertStream(2, inputPath, outputPath, propertyTree.get<int>("stream.chunkSize", 65536), propertyTree.get<bool>("stream.pipelined", true), readFileOptions(propertyTree));
+                break;
+            }
+
             auto start = std::chrono::steady_clock::now();
-            MshReader2D reader2D(inputPath);
-            boost::shared_ptr<GridData> gridData = reader2D.gridData;
+            boost::shared_ptr<GridData> gridData = readThroughSnapshot(propertyTree, inputPath, "MshReader2D", [&]() {return MshReader2D(inputPath).gridData;});
             auto end = std::chrono::steady_clock::now();
             std::chrono::duration<double> elapsedSeconds = end - start;
             std::cout << std::endl << "\tGrid path: " << inputPath;
             std::cout << std::endl << "\tRead in  : " << elapsedSeconds.count() << " s" << std::endl;
 
             start = std::chrono::steady_clock::now();
-            CgnsCreator2D creator2D(gridData, outputPath);
+            CgnsCreator2D creator2D(gridData, outputPath, propertyTree.get<GridIndex>("write.chunkSize", 0), readFileOptions(propertyTree));
             end = std::chrono::steady_clock::now();
             elapsedSeconds = end - start;
             std::cout << std::endl << "\tConverted to CGNS format in: " << elapsedSeconds.count() << " s";
@@ -46,20 +127,37 @@ int main(int argc, char** argv) {
             std::string inputPath  = propertyTree.get<std::string>("path.input");
             std::string outputPath = propertyTree.get<std::string>("path.output");
 
+            if (propertyTree.get<bool>("stream.enabled", false)) {
+                convertStream(3, inputPath, outputPath, propertyTree.get<int>("stream.chunkSize", 65536), propertyTree.get<bool>("stream.pipelined", true), readFileOptions(propertyTree));
+                break;
+            }
+
             auto start = std::chrono::steady_clock::now();
-            MshReader3D reader3D(inputPath);
-            boost::shared_ptr<GridData> gridData = reader3D.gridData;
+            boost::shared_ptr<GridData> gridData = readThroughSnapshot(propertyTree, inputPath, "MshReader3D", [&]() {return MshReader3D(inputPath).gridData;});
             auto end = std::chrono::steady_clock::now();
             std::chrono::duration<double> elapsedSeconds = end - start;
             std::cout << std::endl << "\tGrid path: " << inputPath;
             std::cout << std::endl << "\tRead in  : " << elapsedSeconds.count() << " s" << std::endl;
 
+            renumber(propertyTree, *gridData);
+            bool homogeneousSections = propertyTree.get<bool>("sections.homogeneous", false);
+            if (homogeneousSections)
+                groupElementsByType(*gridData);
+
             start = std::chrono::steady_clock::now();
-            CgnsCreator3D creator3D(gridData, outputPath);
+            std::string fileName;
+            {
+                CgnsCreator3D creator3D(gridData, outputPath, homogeneousSections, propertyTree.get<GridIndex>("write.chunkSize", 0), readFileOptions(propertyTree));
+                if (propertyTree.get<bool>("faces.enabled", false))
+                    creator3D.writeFaces(buildGridFaces(*gridData));
+                fileName = creator3D.getFileName();
+            }
+            if (propertyTree.get<bool>("geometry.enabled", false))
+                writeGeometry(fileName, *gridData);
             end = std::chrono::steady_clock::now();
             elapsedSeconds = end - start;
             std::cout << std::endl << "\tConverted to CGNS format in: " << elapsedSeconds.count() << " s";
-            std::cout << std::endl << "\tOutput file location       : " << creator3D.getFileName() << std::endl << std::endl;
+            std::cout << std::endl << "\tOutput file location       : " << fileName << std::endl << std::endl;
 
             break;
         }
@@ -3,11 +3,13 @@
 #include <Utilities/Output.hpp>
 #include <Utilities/Print.hpp>
 #include <Grid/GridData.hpp>
+#include <Grid/GridSnapshot.hpp>
+#include <Grid/GridDataView.hpp>
 #include <FileMend/CgnsReader/SpecialCgnsReader3D.hpp>
 #include <CgnsInterface/CgnsCreator/CgnsCreator3D.hpp>
+#include <FileMend/VertexMerger.hpp>
 #include <FileMend/WellGenerator.hpp>
 #include <FileMend/GridDataExtractor.hpp>
-#include <FileMend/RadialGridDataReordered.hpp>
 #include <FileMend/MultipleBasesCgnsCreator3D.hpp>
 
 // void renameZones(boost::shared_ptr<GridData> gridData, boost::property_tree::ptree) {
@@ -29,6 +31,27 @@ void applyRatio(boost::shared_ptr<GridData> gridData, const double& ratio) {
             position *= ratio;
 }
 
+// The reservoir keeps every entity of the grid data except the boundaries handed to the radial grid
+GridDataView createReservoirView(boost::shared_ptr<GridData> gridData, boost::property_tree::ptree extractorScript) {
+    std::vector<std::string> extracted;
+    for (auto boundary : extractorScript.get_child("boundaries"))
+        extracted.emplace_back(boundary.second.get_value<std::string>());
+
+    if (extracted.empty())
+        return GridDataView(gridData);
+
+    std::vector<std::string> regions, boundaries, wells;
+    for (const auto& region : gridData->regions)
+        regions.emplace_back(region.name);
+    for (const auto& boundary : gridData->boundaries)
+        if (std::find(extracted.cbegin(), extracted.cend(), boundary.name) == extracted.cend())
+            boundaries.emplace_back(boundary.name);
+    for (const auto& well : gridData->wells)
+        wells.emplace_back(well.name);
+
+    return GridDataView(gridData, regions, boundaries, wells);
+}
+
 int main() {
     boost::property_tree::ptree menderScript;
     boost::property_tree::read_json(std::string(SCRIPT_DIRECTORY) + "ScriptMender.json", menderScript);
@@ -36,8 +59,7 @@ int main() {
     std::string outputPath = menderScript.get<std::string>("path.output");
 
     auto start = std::chrono::steady_clock::now();
-    SpecialCgnsReader3D reader(inputPath);
-    boost::shared_ptr<GridData> gridData = reader.gridData;
+    boost::shared_ptr<GridData> gridData = readThroughSnapshot(menderScript, inputPath, "SpecialCgnsReader3D", [&]() {return SpecialCgnsReader3D(inputPath).gridData;});
     auto end = std::chrono::steady_clock::now();
     std::chrono::duration<double> elapsedSeconds = end - start;
     std::cout << std::endl << "\tGrid path: " << inputPath;
@@ -45,6 +67,14 @@ int main() {
 
     printGridDataInformation(gridData, "\033[1;31m original gridData \033[0m");
 
+    if (menderScript.get<bool>("ScriptVertexMerger.enabled", false)) {
+        start = std::chrono::steady_clock::now();
+        VertexMerger vertexMerger(gridData, menderScript.get_child("ScriptVertexMerger"));
+        end = std::chrono::steady_clock::now();
+        elapsedSeconds = end - start;
+        std::cout << std::endl << "\tMerged " << vertexMerger.numberOfMergedVertices << " vertices in: " << elapsedSeconds.count() << " s" << std::endl;
+    }
+
     if (menderScript.get_child_optional("ScriptWellGenerator")) {
         // boost::property_tree::ptree propertyTree;
         // std::string regionName("WELL_BODY");
@@ -74,7 +104,7 @@ int main() {
 
     printGridDataInformation(gridData, "\033[1;31m gridData after well generation \033[0m");
 
-    boost::shared_ptr<GridData> radialGridData;
+    std::vector<GridDataView> views{GridDataView(gridData)};
     if (menderScript.get_child_optional("ScriptGridDataExtractor")) {
         // boost::property_tree::ptree propertyTree;
 
@@ -111,17 +141,13 @@ int main() {
         // GridDataExtractor gridDataExtractor(gridData, propertyTree);
         // radialGridData = gridDataExtractor.extract;
 
-        GridDataExtractor gridDataExtractor(gridData, menderScript.get_child("ScriptGridDataExtractor"));
-        radialGridData = gridDataExtractor.extract;
+        auto extractorScript = menderScript.get_child("ScriptGridDataExtractor");
+        views = {createReservoirView(gridData, extractorScript), extractView(gridData, extractorScript)};
+        std::cout << std::endl << "\t\033[1;31m radial gridData \033[0m: " << views.back().getNumberOfVertices() << " vertices, " << views.back().getNumberOfElements() << " elements" << std::endl;
     }
 
-    printGridDataInformation(radialGridData, "\033[1;31m radial gridData \033[0m");
-
-    RadialGridDataReordered radialGridDataReordered(radialGridData);
-    radialGridData = radialGridData;
-
     start = std::chrono::steady_clock::now();
-    MultipleBasesCgnsCreator3D creator({gridData, radialGridData}, {"Reservoir", "Well"}, outputPath);
+    MultipleBasesCgnsCreator3D creator(views, {"Reservoir", "Well"}, outputPath);
     end = std::chrono::steady_clock::now();
     elapsedSeconds = end - start;
     std::cout << std::endl << "\tConverted to CGNS format in: " << elapsedSeconds.count() << " s";
@@ -0,0 +1,115 @@
+#include <MshInterface/DecompressionStream.hpp>
+#include <fstream>
+#include <memory>
+#include <zlib.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+DecompressionStream::DecompressionStream(std::string filePath, std::size_t chunkSize, std::size_t capacity) : filePath(filePath), chunkSize(chunkSize), chunks(capacity) {
+    if (!isCompressed(this->filePath))
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The file extension is not .gz or .zst");
+
+    this->producer = std::thread(&DecompressionStream::decompress, this);
+}
+
+DecompressionStream::~DecompressionStream() {
+    this->chunks.close();
+    this->producer.join();
+}
+
+bool DecompressionStream::read(std::string& chunk) {
+    if (this->chunks.pop(chunk))
+        return true;
+    if (this->exception)
+        std::rethrow_exception(this->exception);
+    return false;
+}
+
+bool DecompressionStream::isCompressed(std::string filePath) {
+    std::string extension = boost::filesystem::path(filePath).extension().string();
+    return extension == ".gz" || extension == ".zst";
+}
+
+void DecompressionStream::decompress() {
+    try {
+        if (boost::filesystem::path(this->filePath).extension() == ".gz")
+            this->decompressGzip();
+        else
+            this->decompressZstd();
+    }
+    catch (...) {
+        this->exception = std::current_exception();
+    }
+    this->chunks.close();
+}
+
+void DecompressionStream::decompressGzip() {
+    gzFile file = gzopen(this->filePath.c_str(), "rb");
+    if (!file)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not open " + this->filePath);
+    gzbuffer(file, 1 << 17);
+
+    while (true) {
+        std::string chunk(this->chunkSize, '\0');
+        int size = gzread(file, &chunk[0], chunk.size());
+        if (size < 0) {
+            int error;
+            std::string message(gzerror(file, &error));
+            gzclose(file);
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not decompress " + this->filePath + ": " + message);
+        }
+        if (size == 0)
+            break;
+        chunk.resize(size);
+        if (!this->chunks.push(std::move(chunk)))
+            break;
+    }
+    gzclose(file);
+}
+
+#ifdef HAVE_ZSTD
+void DecompressionStream::decompressZstd() {
+    std::ifstream file(this->filePath, std::ios::binary);
+    if (!file)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not open " + this->filePath);
+
+    std::unique_ptr<ZSTD_DStream, decltype(&ZSTD_freeDStream)> stream(ZSTD_createDStream(), ZSTD_freeDStream);
+    ZSTD_initDStream(stream.get());
+
+    std::string input(ZSTD_DStreamInSize(), '\0');
+    std::string chunk(this->chunkSize, '\0');
+    std::size_t chunkFill = 0;
+    std::size_t lastResult = 0;
+    while (file) {
+        file.read(&input[0], input.size());
+        ZSTD_inBuffer inBuffer{input.data(), std::size_t(file.gcount()), 0};
+        // A full output buffer may leave decoded data inside the stream even after the whole input is consumed
+        bool outputFull = false;
+        while (inBuffer.pos < inBuffer.size || outputFull) {
+            ZSTD_outBuffer outBuffer{&chunk[0], chunk.size(), chunkFill};
+            lastResult = ZSTD_decompressStream(stream.get(), &outBuffer, &inBuffer);
+            if (ZSTD_isError(lastResult))
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not decompress " + this->filePath + ": " + ZSTD_getErrorName(lastResult));
+            chunkFill = outBuffer.pos;
+            outputFull = chunkFill == chunk.size();
+            if (outputFull) {
+                if (!this->chunks.push(std::move(chunk)))
+                    return;
+                chunk.assign(this->chunkSize, '\0');
+                chunkFill = 0;
+            }
+        }
+    }
+    if (lastResult != 0)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The file " + this->filePath + " is truncated");
+
+    chunk.resize(chunkFill);
+    if (chunkFill > 0)
+        this->chunks.push(std::move(chunk));
+}
+#else
+void DecompressionStream::decompressZstd() {
+    throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - MSHtoCGNS was built without zstd support");
+}
+#endif
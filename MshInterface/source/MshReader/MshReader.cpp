@@ -1,6 +1,6 @@
 #include <MshInterface/MshReader.hpp>
 
-MshReader::MshReader(std::string filePath) : filePath(filePath) {
+MshReader::MshReader(std::string filePath, int numberOfThreads) : filePath(filePath), numberOfThreads(numberOfThreads) {
     this->checkFile();
     this->gridData = boost::make_shared<GridData>();
 }
@@ -13,100 +13,400 @@ void MshReader::checkFile() {
     if (!boost::filesystem::exists(this->filePath))
         throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - There is no file in the given path");
 
-    if (input.extension() != ".msh")
-        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The file extension is not .msh");
+    bool compressed = DecompressionStream::isCompressed(this->filePath);
+    if ((compressed ? input.stem().extension() : input.extension()) != ".msh")
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The file extension is not .msh, .msh.gz or .msh.zst");
 
-    this->file = std::ifstream(this->filePath.c_str());
+    if (compressed) {
+        DecompressionStream stream(this->filePath);
+        std::string chunk;
+        while (stream.read(chunk))
+            this->decompressedFile.append(chunk);
+        this->fileBegin = this->decompressedFile.data();
+        this->fileEnd = this->fileBegin + this->decompressedFile.size();
+    }
+    else {
+        this->mappedFile.open(this->filePath);
+        this->fileBegin = this->mappedFile.data();
+        this->fileEnd = this->fileBegin + this->mappedFile.size();
+    }
+    this->indexSections();
+    if (!this->sections.count("MeshFormat"))
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - There is no Mesh Format data in the grid file");
+}
+
+void MshReader::indexSections() {
+    std::string name;
+    const char* sectionBegin = this->fileBegin;
+    const char* position = this->fileBegin;
+    while (position != this->fileEnd) {
+        if (*position == '$') {
+            const char* lineEnd = findLineEnd(position, this->fileEnd);
+            std::string header(position + 1, lineEnd);
+            if (header.size() > 0 && header.back() == '\r')
+                header.pop_back();
+
+            if (header.compare(0, 3, "End")) {
+                name = header;
+                sectionBegin = skipLine(position, this->fileEnd);
+                if (this->format.binary) {
+                    position = this->findBinarySectionEnd(name, sectionBegin);
+                    continue;
+                }
+            }
+            else if (header.compare(3, std::string::npos, name) == 0) {
+                this->sections[name] = std::make_pair(sectionBegin, position);
+                if (name == "MeshFormat")
+                    this->readFormat();
+            }
+        }
+        position = skipLine(position, this->fileEnd);
+    }
+}
+
+void MshReader::readFormat() {
+    const char* position = this->sections["MeshFormat"].first;
+    const char* end = this->sections["MeshFormat"].second;
+
+    this->format.version = parse<double>(position, end);
+    int fileType = parse<int>(position, end);
+    this->format.dataSize = parse<int>(position, end);
+    if (fileType != 0 && fileType != 1)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The file type must be 0 (ASCII) or 1 (binary)");
+
+    this->format.binary = fileType == 1;
+    if (this->format.binary) {
+        position = skipLine(position, end);
+        const char* marker = position;
+        if (parseBinary<int>(position, end, false) == 1)
+            this->format.swapBytes = false;
+        else if (parseBinary<int>(marker, end, true) == 1)
+            this->format.swapBytes = true;
+        else
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not determine the byte order of the binary grid file");
+
+        if (this->format.dataSize != 8 && !(this->format.version >= 4.1 && this->format.dataSize == 4))
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The data size " + std::to_string(this->format.dataSize) + " is not supported");
+    }
+
+    if (this->format.version >= 4.1 && this->format.version < 5.0)
+        this->mshReader4 = boost::make_shared<MshReader4>(this->sections, this->format, this->numberOfThreads);
+    else if (this->format.version < 2.0 || this->format.version >= 3.0)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Only MSH 2 and MSH 4.1 grid files are supported");
+}
+
+const char* MshReader::findBinarySectionEnd(const std::string& name, const char* position) {
+    const char* payloadEnd = nullptr;
+    if (this->mshReader4)
+        payloadEnd = this->mshReader4->findBinarySectionEnd(name, position, this->fileEnd);
+    else if (name == "Nodes")
+        payloadEnd = this->splitBinaryNodes(position, this->fileEnd);
+    else if (name == "Elements")
+        payloadEnd = this->splitBinaryElements(position, this->fileEnd);
+
+    if (payloadEnd)
+        return skipBlanks(payloadEnd, this->fileEnd);
+
+    std::string terminator = "\n$End" + name;
+    const char* sectionEnd = std::search(position - 1, this->fileEnd, terminator.cbegin(), terminator.cend());
+    return sectionEnd == this->fileEnd ? sectionEnd : sectionEnd + 1;
+}
+
+const char* MshReader::splitBinaryNodes(const char* position, const char* end, int recordsPerBlock) {
+    this->nodeBlocks.clear();
+    GridIndex numberOfVertices = toGridIndex(parse<long>(position, end));
+    position = skipLine(position, end);
+    splitBlock(this->nodeBlocks, MshBlock{nullptr, nullptr, numberOfVertices, 0, 0, int(sizeof(int) + 3 * sizeof(double)), nullptr}, true, position, end, recordsPerBlock);
+    return position;
+}
+
+const char* MshReader::splitBinaryElements(const char* position, const char* end, int recordsPerBlock) {
+    this->elementBlocks.clear();
+    GridIndex numberOfElements = toGridIndex(parse<long>(position, end));
+    position = skipLine(position, end);
+
+    // MSH 2 binary blocks store their sizes, tags and vertex indices as 4 byte integers
+    GridIndex index = 0;
+    while (index < numberOfElements) {
+        int type = parseBinary<int>(position, end, this->format.swapBytes);
+        int numberOfElementsInBlock = parseBinary<int>(position, end, this->format.swapBytes);
+        int numberOfTags = parseBinary<int>(position, end, this->format.swapBytes);
+        if (numberOfTags != 2)
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Elements must have exactly 2 tags");
+        if (numberOfElementsInBlock < 1 || long(index) + numberOfElementsInBlock > numberOfElements)
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Invalid number of elements in binary element block");
+
+        int recordSize = (1 + numberOfTags + numberOfElementNodes(type)) * sizeof(int);
+        splitBlock(this->elementBlocks, MshBlock{nullptr, nullptr, numberOfElementsInBlock, index, type - 1, recordSize, nullptr}, true, position, end, recordsPerBlock);
+        index += numberOfElementsInBlock;
+    }
+    return position;
+}
+
+const std::vector<MshBlock>& MshReader::splitNodeBlocks(int recordsPerBlock) {
+    if (this->mshReader4)
+        return this->mshReader4->splitCoordinates(recordsPerBlock);
+
+    auto section = this->sections.find("Nodes");
+    if (section == this->sections.cend())
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - There is no Node data in the grid file");
+
+    const char* position = section->second.first;
+    const char* end = section->second.second;
+    if (this->format.binary) {
+        this->splitBinaryNodes(position, end, recordsPerBlock);
+        return this->nodeBlocks;
+    }
+
+    this->nodeBlocks.clear();
+    GridIndex numberOfVertices = toGridIndex(parse<long>(position, end));
+    position = skipLine(position, end);
+    splitBlock(this->nodeBlocks, MshBlock{nullptr, nullptr, numberOfVertices, 0, 0, 0, nullptr}, false, position, end, recordsPerBlock);
+    return this->nodeBlocks;
+}
+
+void MshReader::readNodeBlock(const MshBlock& block, std::array<double, 3>* coordinates) {
+    if (this->mshReader4) {
+        this->mshReader4->readCoordinates(block, coordinates);
+        return;
+    }
+
+    const char* position = block.begin;
+    for (GridIndex i = 0; i < block.numberOfRecords; i++) {
+        if (this->format.binary) {
+            position += sizeof(int);
+            if (this->format.swapBytes) {
+                for (auto& coordinate : coordinates[i])
+                    coordinate = parseBinary<double>(position, block.end, true);
+            }
+            else {
+                std::memcpy(coordinates[i].data(), position, 3 * sizeof(double));
+                position += 3 * sizeof(double);
+            }
+        }
+        else {
+            parse<GridIndex>(position, block.end);
+            coordinates[i][0] = parse<double>(position, block.end);
+            coordinates[i][1] = parse<double>(position, block.end);
+            coordinates[i][2] = parse<double>(position, block.end);
+            position = skipLine(position, block.end);
+        }
+    }
+}
+
+const std::vector<MshBlock>& MshReader::splitElementBlocks(int recordsPerBlock) {
+    if (this->mshReader4)
+        return this->mshReader4->splitConnectivities(recordsPerBlock);
+
+    auto section = this->sections.find("Elements");
+    if (section == this->sections.cend())
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - There is no Element data in the grid file");
+
+    const char* position = section->second.first;
+    const char* end = section->second.second;
+    if (this->format.binary) {
+        this->splitBinaryElements(position, end, recordsPerBlock);
+        return this->elementBlocks;
+    }
+
+    this->elementBlocks.clear();
+    GridIndex numberOfElements = toGridIndex(parse<long>(position, end));
+    position = skipLine(position, end);
+    splitBlock(this->elementBlocks, MshBlock{nullptr, nullptr, numberOfElements, 0, 0, 0, nullptr}, false, position, end, recordsPerBlock);
+    return this->elementBlocks;
+}
+
+// ASCII blocks carry the element type on every record, so the rows are appended as they are parsed
+void MshReader::readElementBlock(const MshBlock& block, MshConnectivities& rows) {
+    if (this->mshReader4) {
+        this->mshReader4->readConnectivities(block, rows);
+        return;
+    }
+
+    rows.resize(block.numberOfRecords);
+    rows.offsets.assign(1, 0);
+    rows.indices.clear();
+    const char* position = block.begin;
+    for (GridIndex i = 0; i < block.numberOfRecords; i++) {
+        if (this->format.binary) {
+            rows.types[i] = block.type;
+            parseBinary<int>(position, block.end, this->format.swapBytes);
+            rows.physicals[i] = parseBinary<int>(position, block.end, this->format.swapBytes) - 1;
+            parseBinary<int>(position, block.end, this->format.swapBytes);
+            for (int j = 0; j < numberOfElementNodes(block.type + 1); j++)
+                rows.indices.push_back(parseBinary<int>(position, block.end, this->format.swapBytes) - 1);
+        }
+        else {
+            const char* lineEnd = findLineEnd(skipBlanks(position, block.end), block.end);
+            parse<GridIndex>(position, lineEnd);
+            rows.types[i] = parse<int>(position, lineEnd) - 1;
+            if (parse<int>(position, lineEnd) != 2)
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Elements must have exactly 2 tags");
+            rows.physicals[i] = parse<int>(position, lineEnd) - 1;
+            parse<GridIndex>(position, lineEnd);
+            for (int j = 0; j < numberOfElementNodes(rows.types[i] + 1); j++)
+                rows.indices.push_back(parse<GridIndex>(position, lineEnd) - 1);
+            position = skipLine(position, block.end);
+        }
+        rows.offsets.push_back(rows.indices.size());
+    }
 }
 
 void MshReader::readNodes() {
-    int numberOfVertices, temporary;
-    this->file.seekg(0, std::ios::beg);
-    while (strcmp(this->buffer, "$Nodes") && !this->file.eof())
-        this->file >> this->buffer;
-    if (this->file.eof())
+    if (this->mshReader4) {
+        this->mshReader4->readNodes(this->gridData->coordinates);
+        return;
+    }
+
+    auto section = this->sections.find("Nodes");
+    if (section == this->sections.cend())
         throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - There is no Node data in the grid file");
 
-    this->file >> numberOfVertices;
+    const char* position = section->second.first;
+    const char* end = section->second.second;
+
+    GridIndex numberOfVertices = toGridIndex(parse<long>(position, end));
     this->gridData->coordinates.resize(numberOfVertices, std::array<double, 3>());
-    for (int i = 0; i < numberOfVertices; i++)
-        this->file >> temporary >> this->gridData->coordinates[i][0] >> this->gridData->coordinates[i][1] >> this->gridData->coordinates[i][2];
+    if (this->format.binary) {
+        this->splitBinaryNodes(section->second.first, end);
+        parallelFor(this->nodeBlocks.size(), this->numberOfThreads, [this](int task) {
+            const MshBlock& block = this->nodeBlocks[task];
+            this->readNodeBlock(block, this->gridData->coordinates.data() + block.firstIndex);
+        });
+        return;
+    }
+
+    forEachLine(skipLine(position, end), end, numberOfVertices, this->numberOfThreads, [this](GridIndex i, const char* position, const char* lineEnd) {
+        parse<GridIndex>(position, lineEnd);
+        this->gridData->coordinates[i][0] = parse<double>(position, lineEnd);
+        this->gridData->coordinates[i][1] = parse<double>(position, lineEnd);
+        this->gridData->coordinates[i][2] = parse<double>(position, lineEnd);
+    });
+}
+
+// Boundaries are the physical entities one dimension below the grid and regions those of the grid dimension
+void MshReader::readPhysicalEntities() {
+    auto section = this->sections.find("PhysicalNames");
+    if (section == this->sections.cend())
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - There is no Physical Entities data in the grid file");
+
+    const char* position = section->second.first;
+    const char* end = section->second.second;
+
+    this->numberOfPhysicalEntities = parse<int>(position, end);
+    std::vector<int> entitiesTypes;
+    std::vector<int> entitiesIndices;
+    std::vector<std::string> entitiesNames;
+    for (int i = 0; i < this->numberOfPhysicalEntities; i++) {
+        int type = parse<int>(position, end) - 1;
+        int index = parse<int>(position, end) - 1;
+        entitiesTypes.push_back(type);
+        entitiesIndices.push_back(index);
+        entitiesNames.push_back(parseQuoted(position, end));
+    }
+
+    std::vector<int> regionsIndices, boundaryIndices;
+    for (int i = 0; i < this->numberOfPhysicalEntities; i++) {
+        if (entitiesTypes[i] == this->gridData->dimension - 2)
+            boundaryIndices.push_back(entitiesIndices[i]);
+        else if (entitiesTypes[i] == this->gridData->dimension - 1)
+            regionsIndices.push_back(entitiesIndices[i]);
+        else
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Physical entity " + std::to_string(entitiesTypes[i]) + " not supported");
+    }
+
+    this->numberOfBoundaries = boundaryIndices.size();
+    this->gridData->boundaries.resize(boundaryIndices.size());
+    for (unsigned i = 0; i < boundaryIndices.size(); i++)
+        this->gridData->boundaries[i].name = entitiesNames[boundaryIndices[i]];
+
+    this->numberOfRegions = regionsIndices.size();
+    this->gridData->regions.resize(regionsIndices.size());
+    for (unsigned i = 0; i < regionsIndices.size(); i++)
+        this->gridData->regions[i].name = entitiesNames[regionsIndices[i]];
 }
 
 void MshReader::readConnectivities() {
-    int numberOfElements;
-    this->file.seekg(0, std::ios::beg);
-    while (strcmp(this->buffer, "$Elements") && !this->file.eof())
-        this->file >> this->buffer;
-    if (this->file.eof())
-        this->file.clear();
-    else {
-        this->file >> numberOfElements;
-        for (int i = 0; i < numberOfElements+1; i++) {
-            std::string line;
-            std::getline(this->file, line);
-            std::istringstream stream(line);
-            std::vector<int> connectivity;
-            int value;
-            while (stream >> value) {
-                value--;
-                connectivity.push_back(value);
-            }
-            this->connectivities.emplace_back(std::move(connectivity));
-        }
+    if (this->mshReader4) {
+        this->mshReader4->readConnectivities(this->connectivities);
+        return;
     }
-    this->connectivities.erase(this->connectivities.begin());
 
-    if (connectivities[0][2] != 1)
-        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Elements must have exactly 2 tags");
+    auto section = this->sections.find("Elements");
+    if (section == this->sections.cend())
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - There is no Element data in the grid file");
+
+    const char* position = section->second.first;
+    const char* end = section->second.second;
 
-    for (unsigned i = 0; i < this->connectivities.size(); i++) {
-        this->connectivities[i].erase(this->connectivities[i].begin()    );
-        this->connectivities[i].erase(this->connectivities[i].begin() + 1);
-        this->connectivities[i].erase(this->connectivities[i].begin() + 2);
+    GridIndex numberOfElements = toGridIndex(parse<long>(position, end));
+    this->connectivities.resize(numberOfElements);
+    if (this->format.binary) {
+        this->splitBinaryElements(section->second.first, end);
+        for (const auto& block : this->elementBlocks)
+            std::fill_n(this->connectivities.types.begin() + block.firstIndex, block.numberOfRecords, block.type);
+        this->connectivities.computeOffsets();
+
+        parallelFor(this->elementBlocks.size(), this->numberOfThreads, [this](int task) {
+            const MshBlock& block = this->elementBlocks[task];
+            const char* position = block.begin;
+            for (GridIndex i = block.firstIndex; i < block.firstIndex + block.numberOfRecords; i++) {
+                parseBinary<int>(position, block.end, this->format.swapBytes);
+                this->connectivities.physicals[i] = parseBinary<int>(position, block.end, this->format.swapBytes) - 1;
+                parseBinary<int>(position, block.end, this->format.swapBytes);
+                for (std::size_t j = this->connectivities.offsets[i]; j < this->connectivities.offsets[i+1]; j++)
+                    this->connectivities.indices[j] = parseBinary<int>(position, block.end, this->format.swapBytes) - 1;
+            }
+        });
+        return;
     }
+
+    // The header is parsed first so the vertices can be placed at their final offsets on a second pass
+    std::vector<unsigned char> headerLengths(numberOfElements);
+    position = skipLine(position, end);
+    forEachLine(position, end, numberOfElements, this->numberOfThreads, [this, &headerLengths](GridIndex i, const char* position, const char* lineEnd) {
+        const char* lineBegin = position;
+        parse<GridIndex>(position, lineEnd);
+        this->connectivities.types[i] = parse<int>(position, lineEnd) - 1;
+        if (parse<int>(position, lineEnd) != 2)
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Elements must have exactly 2 tags");
+        this->connectivities.physicals[i] = parse<int>(position, lineEnd) - 1;
+        parse<GridIndex>(position, lineEnd);
+        if (position - lineBegin > 255)
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Element header is too long");
+        headerLengths[i] = position - lineBegin;
+    });
+    this->connectivities.computeOffsets();
+
+    forEachLine(position, end, numberOfElements, this->numberOfThreads, [this, &headerLengths](GridIndex i, const char* position, const char* lineEnd) {
+        position += headerLengths[i];
+        for (std::size_t j = this->connectivities.offsets[i]; j < this->connectivities.offsets[i+1]; j++)
+            this->connectivities.indices[j] = parse<GridIndex>(position, lineEnd) - 1;
+    });
 }
 
 void MshReader::divideConnectivities() {
-    this->elements = std::vector<std::vector<int>>(this->connectivities.begin() + this->numberOfFacets, this->connectivities.end());
-    int regionIndex = 1;
-    std::stable_sort(this->elements.begin(), this->elements.end(), [regionIndex](const auto& a, const auto& b) {return a[regionIndex] < b[regionIndex];});
-    for (unsigned i = 0; i < this->elements.size(); i++)
-        this->elements[i].push_back(i);
-    int numberOfElements = elements.size();
-
-    this->facets = std::vector<std::vector<int>>(this->connectivities.begin(), this->connectivities.begin() + this->numberOfFacets);
-    unsigned boundaryIndex = 1;
-    std::stable_sort(this->facets.begin(), this->facets.end(), [boundaryIndex](const auto& a, const auto& b) {return a[boundaryIndex] < b[boundaryIndex];});
-    for (unsigned i = 0; i < this->facets.size(); i++)
-        this->facets[i].push_back(numberOfElements + i);
+    this->numberOfElements = this->connectivities.size() - this->numberOfFacets;
 }
 
 void MshReader::assignElementsToRegions() {
-    int counter = 0;
-    std::vector<unsigned> regionStart;
-    regionStart.emplace_back(0);
-    for (unsigned i = 0; i < this->elements.size()-1; i++) {
-        if (this->elements[i][1] == this->elements[i+1][1])
-            counter++;
-        else {
-            counter++;
-            regionStart.push_back(counter);
-        }
-    }
-    regionStart.push_back(this->elements.size());
+    int numberOfPhysicals = 0;
+    for (GridIndex i = this->numberOfFacets; i < this->connectivities.size(); i++)
+        numberOfPhysicals = std::max(numberOfPhysicals, this->connectivities.physicals[i] + 1);
 
-    for (unsigned i = 0; i < regionStart.size()-1; i++)
-        for (unsigned j = regionStart[i]; j < regionStart[i+1]; j++)
-            this->elements[j][1] = i;
+    this->elements = countingSort(this->numberOfFacets, this->connectivities.size(), numberOfPhysicals, this->numberOfThreads, [this](GridIndex row) {return this->connectivities.physicals[row];}, this->regionOffsets);
+    this->regionOffsets.erase(std::unique(this->regionOffsets.begin(), this->regionOffsets.end()), this->regionOffsets.end());
 
-    this->regionElements.resize(this->numberOfRegions, std::vector<int>());
-    for (unsigned i = 0; i < this->elements.size(); i++)
-        this->regionElements[this->elements[i][1]].push_back(i);
+    if (int(this->regionOffsets.size()) - 1 != this->numberOfRegions)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Every region must have elements");
 }
 
 void MshReader::assignFacetsToBoundaries() {
-    this->boundaryFacets.resize(this->numberOfBoundaries, std::vector<int>());
-    for (unsigned i = 0; i < this->facets.size(); i++)
-        this->boundaryFacets[this->facets[i][1]].push_back(i);
+    this->facets = countingSort(0, this->numberOfFacets, this->numberOfBoundaries, this->numberOfThreads, [this](GridIndex row) {return this->connectivities.physicals[row];}, this->boundaryOffsets);
+}
+
+void MshReader::releaseConnectivities() {
+    this->connectivities.clear();
+    std::vector<GridIndex>().swap(this->elements);
+    std::vector<GridIndex>().swap(this->facets);
 }
@@ -1,6 +1,6 @@
 #include <MshInterface/MshReader/MshReader2D.hpp>
 
-MshReader2D::MshReader2D(std::string filePath) : MshReader(filePath) {
+MshReader2D::MshReader2D(std::string filePath, int numberOfThreads) : MshReader(filePath, numberOfThreads) {
     this->gridData->dimension = 2;
     this->readNodes();
     this->readPhysicalEntities();
@@ -12,62 +12,13 @@ MshReader2D::MshReader2D(std::string filePath) : MshReader(filePath) {
     this->addRegions();
     this->addBoundaries();
     this->defineBoundaryVertices();
-}
-
-void MshReader2D::readPhysicalEntities() {
-    this->file.seekg(0, std::ios::beg);
-    while (strcmp(this->buffer, "$PhysicalNames") && !this->file.eof())
-        this->file >> this->buffer;
-    if (this->file.eof())
-        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - There is no Physical Entities data in the grid file");
-
-    this->file >> this->numberOfPhysicalEntities;
-    std::vector<int> entitiesTypes;
-    std::vector<int> entitiesIndices;
-    std::vector<std::string> entitiesNames;
-    for (int i = 0; i < this->numberOfPhysicalEntities; i++) {
-        int type, index;
-        std::string name;
-        this->file >> type >> index >> name;
-        type--;
-        index--;
-        name.erase(name.begin()); name.erase(name.end()-1);
-        entitiesTypes.push_back(type);
-        entitiesIndices.push_back(index);
-        entitiesNames.push_back(name);
-    }
-
-    std::vector<int> regionsIndices, boundaryIndices;
-    for (int i = 0; i < this->numberOfPhysicalEntities; i++) {
-        switch (entitiesTypes[i]) {
-            case 0: {
-                boundaryIndices.push_back(entitiesIndices[i]);
-                break;
-            }
-            case 1: {
-                regionsIndices.push_back(entitiesIndices[i]);
-                break;
-            }
-            default:
-                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Non supported physical entity found");
-        }
-    }
-
-    this->numberOfBoundaries = boundaryIndices.size();
-    this->gridData->boundaries.resize(boundaryIndices.size());
-    for (unsigned i = 0; i < boundaryIndices.size(); i++)
-        this->gridData->boundaries[i].name = entitiesNames[boundaryIndices[i]];
-
-    this->numberOfRegions = regionsIndices.size();
-    this->gridData->regions.resize(regionsIndices.size());
-    for (unsigned i = 0; i < regionsIndices.size(); i++)
-        this->gridData->regions[i].name = entitiesNames[regionsIndices[i]];
+    this->releaseConnectivities();
 }
 
 void MshReader2D::determineNumberOfFacets() {
     this->numberOfFacets = 0;
-    for (unsigned i = 0; i < this->connectivities.size(); i++) {
-        if (this->connectivities[i][0] != 0)
+    for (GridIndex i = 0; i < this->connectivities.size(); i++) {
+        if (this->connectivities.types[i] != 0)
             break;
         else
             this->numberOfFacets++;
@@ -75,23 +26,30 @@ void MshReader2D::determineNumberOfFacets() {
 }
 
 void MshReader2D::addRegions() {
-    for (unsigned i = 0; i < this->regionElements.size(); i++) {
-        this->gridData->regions[i].elementBegin = this->regionElements[i].front();
-        this->gridData->regions[i].elementEnd   = this->regionElements[i].back() + 1;
-        for (unsigned j = 0; j < this->regionElements[i].size(); j++) {
-            int index = this->regionElements[i][j];
-            int type  = this->elements[index][0];
-            std::vector<int> connectivity(this->elements[index].cbegin() + 2, this->elements[index].cend());
-            switch (type) {
+    std::array<GridIndex, 32> numberOfRows{};
+    for (GridIndex row : this->elements)
+        numberOfRows[this->connectivities.types[row]]++;
+    this->gridData->triangleConnectivity.reserve(numberOfRows[1]);
+    this->gridData->quadrangleConnectivity.reserve(numberOfRows[2]);
+
+    for (unsigned i = 0; i < this->gridData->regions.size(); i++) {
+        this->gridData->regions[i].elementBegin = this->regionOffsets[i];
+        this->gridData->regions[i].elementEnd   = this->regionOffsets[i+1];
+        for (GridIndex j = this->regionOffsets[i]; j < this->regionOffsets[i+1]; j++) {
+            GridIndex row = this->elements[j];
+            const GridIndex* vertices = this->connectivities.vertices(row);
+            switch (this->connectivities.types[row]) {
                 case 1: {
-                    std::array<int, 4> triangle;
-                    std::copy_n(std::begin(connectivity), 4, std::begin(triangle));
+                    std::array<GridIndex, 4> triangle;
+                    std::copy_n(vertices, 3, std::begin(triangle));
+                    triangle[3] = j;
                     this->gridData->triangleConnectivity.emplace_back(std::move(triangle));
                     break;
                 }
                 case 2: {
-                    std::array<int, 5> quadrangle;
-                    std::copy_n(std::begin(connectivity), 5, std::begin(quadrangle));
+                    std::array<GridIndex, 5> quadrangle;
+                    std::copy_n(vertices, 4, std::begin(quadrangle));
+                    quadrangle[4] = j;
                     this->gridData->quadrangleConnectivity.emplace_back(std::move(quadrangle));
                     break;
                 }
@@ -103,17 +61,22 @@ void MshReader2D::addRegions() {
 }
 
 void MshReader2D::addBoundaries() {
-    for (unsigned i = 0; i < this->boundaryFacets.size(); i++) {
-        this->gridData->boundaries[i].facetBegin = this->facets[this->boundaryFacets[i].front()].back();
-        this->gridData->boundaries[i].facetEnd   = this->facets[this->boundaryFacets[i].back() ].back() + 1;
-        for (unsigned j = 0; j < this->boundaryFacets[i].size(); j++) {
-            int index = this->boundaryFacets[i][j];
-            int type  = this->facets[index][0];
-            std::vector<int> connectivity(this->facets[index].cbegin() + 2, this->facets[index].cend());
-            switch (type) {
+    std::array<GridIndex, 32> numberOfRows{};
+    for (GridIndex row : this->facets)
+        numberOfRows[this->connectivities.types[row]]++;
+    this->gridData->lineConnectivity.reserve(numberOfRows[0]);
+
+    for (unsigned i = 0; i < this->gridData->boundaries.size(); i++) {
+        this->gridData->boundaries[i].facetBegin = this->numberOfElements + this->boundaryOffsets[i];
+        this->gridData->boundaries[i].facetEnd   = this->numberOfElements + this->boundaryOffsets[i+1];
+        for (GridIndex j = this->boundaryOffsets[i]; j < this->boundaryOffsets[i+1]; j++) {
+            GridIndex row = this->facets[j];
+            const GridIndex* vertices = this->connectivities.vertices(row);
+            switch (this->connectivities.types[row]) {
                 case 0: {
-                    std::array<int, 3> line;
-                    std::copy_n(std::begin(connectivity), 3, std::begin(line));
+                    std::array<GridIndex, 3> line;
+                    std::copy_n(vertices, 2, std::begin(line));
+                    line[2] = this->numberOfElements + j;
                     this->gridData->lineConnectivity.emplace_back(std::move(line));
                     break;
                 }
@@ -125,12 +88,9 @@ void MshReader2D::addBoundaries() {
 }
 
 void MshReader2D::defineBoundaryVertices() {
-    for (auto boundary = this->gridData->boundaries.begin(); boundary < this->gridData->boundaries.end(); boundary++) {
-        std::set<int> vertices;
-        std::vector<std::array<int, 3>> boundaryConnectivity(this->gridData->lineConnectivity.cbegin() + boundary->facetBegin - this->elements.size(), this->gridData->lineConnectivity.cbegin() + boundary->facetEnd - this->elements.size());
-        for (unsigned j = 0; j < boundaryConnectivity.size(); j++)
-            for (unsigned k = 0; k != 2u; k++)
-                vertices.insert(boundaryConnectivity[j][k]);
-        boundary->vertices = std::vector<int>(vertices.cbegin(), vertices.cend());
-    }
+    markVertices(this->gridData->boundaries.size(), this->gridData->coordinates.size(), this->numberOfThreads, [this](int i, VertexMarker& marker) {
+        BoundaryData& boundary = this->gridData->boundaries[i];
+        marker.mark(this->gridData->lineConnectivity, boundary.facetBegin, boundary.facetEnd);
+        boundary.vertices = marker.extract();
+    });
 }
@@ -1,6 +1,6 @@
 #include <MshInterface/MshReader/MshReader3D.hpp>
 
-MshReader3D::MshReader3D(std::string filePath) : MshReader(filePath) {
+MshReader3D::MshReader3D(std::string filePath, int numberOfThreads) : MshReader(filePath, numberOfThreads) {
     this->gridData->dimension = 3;
     this->readNodes();
     this->readPhysicalEntities();
@@ -12,62 +12,13 @@ MshReader3D::MshReader3D(std::string filePath) : MshReader(filePath) {
     this->addRegions();
     this->addBoundaries();
     this->defineBoundaryVertices();
-}
-
-void MshReader3D::readPhysicalEntities() {
-    this->file.seekg(0, std::ios::beg);
-    while (strcmp(this->buffer, "$PhysicalNames") && !this->file.eof())
-        this->file >> this->buffer;
-    if (this->file.eof())
-        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - There is no Physical Entities data in the grid file");
-
-    this->file >> this->numberOfPhysicalEntities;
-    std::vector<int> entitiesTypes;
-    std::vector<int> entitiesIndices;
-    std::vector<std::string> entitiesNames;
-    for (int i = 0; i < this->numberOfPhysicalEntities; i++) {
-        int type, index;
-        std::string name;
-        this->file >> type >> index >> name;
-        type--;
-        index--;
-        name.erase(name.begin()); name.erase(name.end()-1);
-        entitiesTypes.push_back(type);
-        entitiesIndices.push_back(index);
-        entitiesNames.push_back(name);
-    }
-
-    std::vector<int> regionsIndices, boundaryIndices;
-    for (int i = 0; i < this->numberOfPhysicalEntities; i++) {
-        switch (entitiesTypes[i]) {
-            case 1: {
-                boundaryIndices.push_back(entitiesIndices[i]);
-                break;
-            }
-            case 2: {
-                regionsIndices.push_back(entitiesIndices[i]);
-                break;
-            }
-            default:
-                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Physical entity " + std::to_string(entitiesTypes[i]) + " not supported");
-        }
-    }
-
-    this->numberOfBoundaries = boundaryIndices.size();
-    this->gridData->boundaries.resize(boundaryIndices.size());
-    for (unsigned i = 0; i < boundaryIndices.size(); i++)
-        this->gridData->boundaries[i].name = entitiesNames[boundaryIndices[i]];
-
-    this->numberOfRegions = regionsIndices.size();
-    this->gridData->regions.resize(regionsIndices.size());
-    for (unsigned i = 0; i < regionsIndices.size(); i++)
-        this->gridData->regions[i].name = entitiesNames[regionsIndices[i]];
+    this->releaseConnectivities();
 }
 
 void MshReader3D::determineNumberOfFacets() {
     this->numberOfFacets = 0;
-    for (unsigned i = 0; i < this->connectivities.size(); i++) {
-        if (this->connectivities[i][0] != 1 && this->connectivities[i][0] != 2)
+    for (GridIndex i = 0; i < this->connectivities.size(); i++) {
+        if (this->connectivities.types[i] != 1 && this->connectivities.types[i] != 2)
             break;
         else
             this->numberOfFacets++;
@@ -75,23 +26,30 @@ void MshReader3D::determineNumberOfFacets() {
 }
 
 void MshReader3D::addRegions() {
-    for (unsigned i = 0; i < this->regionElements.size(); i++) {
-        this->gridData->regions[i].elementBegin = this->regionElements[i].front();
-        this->gridData->regions[i].elementEnd   = this->regionElements[i].back() + 1;
-        for (unsigned j = 0; j < this->regionElements[i].size(); j++) {
-            int index = this->regionElements[i][j];
-            int type  = this->elements[index][0];
-            std::vector<int> connectivity(this->elements[index].cbegin() + 2, this->elements[index].cend());
-            switch (type) {
+    std::array<GridIndex, 32> numberOfRows{};
+    for (GridIndex row : this->elements)
+        numberOfRows[this->connectivities.types[row]]++;
+    this->gridData->tetrahedronConnectivity.reserve(numberOfRows[3]);
+    this->gridData->hexahedronConnectivity.reserve(numberOfRows[4]);
+
+    for (unsigned i = 0; i < this->gridData->regions.size(); i++) {
+        this->gridData->regions[i].elementBegin = this->regionOffsets[i];
+        this->gridData->regions[i].elementEnd   = this->regionOffsets[i+1];
+        for (GridIndex j = this->regionOffsets[i]; j < this->regionOffsets[i+1]; j++) {
+            GridIndex row = this->elements[j];
+            const GridIndex* vertices = this->connectivities.vertices(row);
+            switch (this->connectivities.types[row]) {
                 case 3: {
-                    std::array<int, 5> tetrahedron;
-                    std::copy_n(std::begin(connectivity), 5, std::begin(tetrahedron));
+                    std::array<GridIndex, 5> tetrahedron;
+                    std::copy_n(vertices, 4, std::begin(tetrahedron));
+                    tetrahedron[4] = j;
                     this->gridData->tetrahedronConnectivity.emplace_back(std::move(tetrahedron));
                     break;
                 }
                 case 4: {
-                    std::array<int, 9> hexahedron;
-                    std::copy_n(std::begin(connectivity), 9, std::begin(hexahedron));
+                    std::array<GridIndex, 9> hexahedron;
+                    std::copy_n(vertices, 8, std::begin(hexahedron));
+                    hexahedron[8] = j;
                     this->gridData->hexahedronConnectivity.emplace_back(std::move(hexahedron));
                     break;
                 }
@@ -103,23 +61,30 @@ void MshReader3D::addRegions() {
 }
 
 void MshReader3D::addBoundaries() {
-    for (unsigned i = 0; i < this->boundaryFacets.size(); i++) {
-        this->gridData->boundaries[i].facetBegin = this->facets[this->boundaryFacets[i].front()].back();
-        this->gridData->boundaries[i].facetEnd   = this->facets[this->boundaryFacets[i].back() ].back() + 1;
-        for (unsigned j = 0; j < this->boundaryFacets[i].size(); j++) {
-            int index = this->boundaryFacets[i][j];
-            int type  = this->facets[index][0];
-            std::vector<int> connectivity(this->facets[index].cbegin() + 2, this->facets[index].cend());
-            switch (type) {
+    std::array<GridIndex, 32> numberOfRows{};
+    for (GridIndex row : this->facets)
+        numberOfRows[this->connectivities.types[row]]++;
+    this->gridData->triangleConnectivity.reserve(numberOfRows[1]);
+    this->gridData->quadrangleConnectivity.reserve(numberOfRows[2]);
+
+    for (unsigned i = 0; i < this->gridData->boundaries.size(); i++) {
+        this->gridData->boundaries[i].facetBegin = this->numberOfElements + this->boundaryOffsets[i];
+        this->gridData->boundaries[i].facetEnd   = this->numberOfElements + this->boundaryOffsets[i+1];
+        for (GridIndex j = this->boundaryOffsets[i]; j < this->boundaryOffsets[i+1]; j++) {
+            GridIndex row = this->facets[j];
+            const GridIndex* vertices = this->connectivities.vertices(row);
+            switch (this->connectivities.types[row]) {
                 case 1: {
-                    std::array<int, 4> triangle;
-                    std::copy_n(std::begin(connectivity), 4, std::begin(triangle));
+                    std::array<GridIndex, 4> triangle;
+                    std::copy_n(vertices, 3, std::begin(triangle));
+                    triangle[3] = this->numberOfElements + j;
                     this->gridData->triangleConnectivity.emplace_back(std::move(triangle));
                     break;
                 }
                 case 2: {
-                    std::array<int, 5> quadrangle;
-                    std::copy_n(std::begin(connectivity), 5, std::begin(quadrangle));
+                    std::array<GridIndex, 5> quadrangle;
+                    std::copy_n(vertices, 4, std::begin(quadrangle));
+                    quadrangle[4] = this->numberOfElements + j;
                     this->gridData->quadrangleConnectivity.emplace_back(std::move(quadrangle));
                     break;
                 }
@@ -131,21 +96,10 @@ void MshReader3D::addBoundaries() {
 }
 
 void MshReader3D::defineBoundaryVertices() {
-    for (auto boundary = this->gridData->boundaries.begin(); boundary != this->gridData->boundaries.end(); boundary++) {
-        std::set<int> vertices;
-        if (this->gridData->triangleConnectivity.size() > 0) {
-            std::vector<std::array<int, 4>> boundaryConnectivity(this->gridData->triangleConnectivity.cbegin() + boundary->facetBegin - this->elements.size(), this->gridData->triangleConnectivity.cbegin() + boundary->facetEnd - this->elements.size());
-            for (unsigned j = 0; j < boundaryConnectivity.size(); j++)
-                for (unsigned k = 0; k != 3u; k++)
-                    vertices.insert(boundaryConnectivity[j][k]);
-            boundary->vertices = std::vector<int>(vertices.begin(), vertices.end());
-        }
-        else {
-            std::vector<std::array<int, 5>> boundaryConnectivity(this->gridData->quadrangleConnectivity.cbegin() + boundary->facetBegin - this->elements.size(), this->gridData->quadrangleConnectivity.cbegin() + boundary->facetEnd - this->elements.size());
-            for (unsigned j = 0; j < boundaryConnectivity.size(); j++)
-                for (unsigned k = 0; k != 4u; k++)
-                    vertices.insert(boundaryConnectivity[j][k]);
-            boundary->vertices = std::vector<int>(vertices.begin(), vertices.end());
-        }
-    }
+    markVertices(this->gridData->boundaries.size(), this->gridData->coordinates.size(), this->numberOfThreads, [this](int i, VertexMarker& marker) {
+        BoundaryData& boundary = this->gridData->boundaries[i];
+        marker.mark(this->gridData->triangleConnectivity, boundary.facetBegin, boundary.facetEnd);
+        marker.mark(this->gridData->quadrangleConnectivity, boundary.facetBegin, boundary.facetEnd);
+        boundary.vertices = marker.extract();
+    });
 }
@@ -0,0 +1,202 @@
+#include <MshInterface/MshReader/MshStreamReader.hpp>
+
+MshStreamReader::MshStreamReader(std::string filePath, int dimension, int chunkSize, int numberOfThreads) : MshReader(filePath, numberOfThreads), chunkSize(chunkSize) {
+    if (dimension != 2 && dimension != 3)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Dimension must be either 2 or 3");
+    if (chunkSize < 1)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The chunk size must be positive");
+
+    this->gridData->dimension = dimension;
+    this->nodeBlocks = this->splitNodeBlocks(this->chunkSize);
+    this->numberOfVertices = 0;
+    for (const auto& block : this->nodeBlocks)
+        this->numberOfVertices += block.numberOfRecords;
+
+    this->readPhysicalEntities();
+    this->elementBlocks = this->splitElementBlocks(this->chunkSize);
+    this->determineNumberOfFacets();
+    this->addRegions();
+    this->addBoundaries();
+    this->defineBoundaryVertices();
+}
+
+boost::shared_ptr<GridData> MshStreamReader::getGridData() const {
+    return this->gridData;
+}
+
+GridIndex MshStreamReader::getNumberOfVertices() const {
+    return this->numberOfVertices;
+}
+
+int MshStreamReader::getSectionElementSize(int section) const {
+    return this->sectionElementSizes.at(section);
+}
+
+// First pass: the facets are the leading rows of facet type, so they are counted together with the elements of every physical entity.
+// Only the counts and the boundary vertices are kept, the connectivities are read again while streaming.
+void MshStreamReader::determineNumberOfFacets() {
+    this->numberOfFacets = 0;
+    this->numberOfElements = 0;
+    this->boundaryCounts.assign(this->numberOfBoundaries, 0);
+    this->boundaryElementSizes.assign(this->numberOfBoundaries, -1);
+
+    this->forEachElementBlock([this](const MshConnectivities& rows) {
+        std::vector<std::size_t> chunkBegins(this->numberOfBoundaries);
+        for (int i = 0; i < this->numberOfBoundaries; i++)
+            chunkBegins[i] = this->gridData->boundaries[i].vertices.size();
+
+        for (GridIndex i = 0; i < rows.size(); i++) {
+            int type = rows.types[i];
+            int physical = rows.physicals[i];
+            int numberOfNodes = rows.offsets[i+1] - rows.offsets[i];
+            if (this->numberOfElements == 0 && this->isFacet(type)) {
+                if (physical < 0 || physical >= this->numberOfBoundaries)
+                    throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Facet physical entity " + std::to_string(physical + 1) + " is not a boundary");
+
+                this->numberOfFacets++;
+                this->boundaryCounts[physical]++;
+                this->mergeElementSize(this->boundaryElementSizes[physical], numberOfNodes);
+                std::vector<GridIndex>& vertices = this->gridData->boundaries[physical].vertices;
+                vertices.insert(vertices.end(), rows.vertices(i), rows.vertices(i) + numberOfNodes);
+            }
+            else {
+                if (!this->isElement(type) || physical < 0)
+                    throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Non supported element found");
+
+                if (physical >= int(this->physicalCounts.size())) {
+                    this->physicalCounts.resize(physical + 1, 0);
+                    this->physicalElementSizes.resize(physical + 1, -1);
+                }
+                this->numberOfElements++;
+                this->physicalCounts[physical]++;
+                this->mergeElementSize(this->physicalElementSizes[physical], numberOfNodes);
+            }
+        }
+
+        // The vertices shared by the facets of a chunk are dropped right away, only those shared across chunks wait for defineBoundaryVertices
+        for (int i = 0; i < this->numberOfBoundaries; i++) {
+            std::vector<GridIndex>& vertices = this->gridData->boundaries[i].vertices;
+            std::sort(vertices.begin() + chunkBegins[i], vertices.end());
+            vertices.erase(std::unique(vertices.begin() + chunkBegins[i], vertices.end()), vertices.end());
+        }
+    });
+}
+
+void MshStreamReader::addRegions() {
+    this->physicalRegions.assign(this->physicalCounts.size(), -1);
+    this->sectionElementSizes.clear();
+    this->sectionOffsets.clear();
+
+    GridIndex elementBegin = 0;
+    for (unsigned physical = 0; physical < this->physicalCounts.size(); physical++) {
+        if (this->physicalCounts[physical] == 0)
+            continue;
+
+        int region = this->sectionOffsets.size();
+        if (region == this->numberOfRegions)
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Every region must have elements");
+
+        this->physicalRegions[physical] = region;
+        this->gridData->regions[region].elementBegin = elementBegin;
+        this->gridData->regions[region].elementEnd = elementBegin + this->physicalCounts[physical];
+        this->sectionElementSizes.push_back(this->physicalElementSizes[physical]);
+        this->sectionOffsets.push_back(elementBegin);
+        elementBegin += this->physicalCounts[physical];
+    }
+
+    if (int(this->sectionOffsets.size()) != this->numberOfRegions)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Every region must have elements");
+}
+
+void MshStreamReader::addBoundaries() {
+    GridIndex facetBegin = this->numberOfElements;
+    for (int i = 0; i < this->numberOfBoundaries; i++) {
+        this->gridData->boundaries[i].facetBegin = facetBegin;
+        this->gridData->boundaries[i].facetEnd = facetBegin + this->boundaryCounts[i];
+        this->sectionElementSizes.push_back(this->boundaryElementSizes[i]);
+        this->sectionOffsets.push_back(facetBegin);
+        facetBegin += this->boundaryCounts[i];
+    }
+}
+
+void MshStreamReader::defineBoundaryVertices() {
+    parallelFor(this->numberOfBoundaries, this->numberOfThreads, [this](int i) {
+        std::vector<GridIndex>& vertices = this->gridData->boundaries[i].vertices;
+        std::sort(vertices.begin(), vertices.end());
+        vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+        vertices.shrink_to_fit();
+    });
+}
+
+// Blocks are read concurrently in groups of one block per thread and handed out in file order, so at most numberOfThreads chunks are held
+void MshStreamReader::forEachElementBlock(const std::function<void(const MshConnectivities&)>& function) {
+    std::vector<MshConnectivities> rows(this->numberOfThreads);
+    for (unsigned first = 0; first < this->elementBlocks.size(); first += this->numberOfThreads) {
+        int numberOfBlocks = std::min<int>(this->numberOfThreads, this->elementBlocks.size() - first);
+        parallelFor(numberOfBlocks, this->numberOfThreads, [&](int task) {
+            this->readElementBlock(this->elementBlocks[first + task], rows[task]);
+        });
+        for (int task = 0; task < numberOfBlocks; task++)
+            function(rows[task]);
+    }
+}
+
+void MshStreamReader::streamCoordinates(const std::function<void(const CoordinateChunk&)>& write) {
+    std::vector<CoordinateChunk> chunks(this->numberOfThreads);
+    for (unsigned first = 0; first < this->nodeBlocks.size(); first += this->numberOfThreads) {
+        int numberOfBlocks = std::min<int>(this->numberOfThreads, this->nodeBlocks.size() - first);
+        parallelFor(numberOfBlocks, this->numberOfThreads, [&](int task) {
+            const MshBlock& block = this->nodeBlocks[first + task];
+            chunks[task].begin = block.firstIndex;
+            chunks[task].coordinates.resize(block.numberOfRecords);
+            this->readNodeBlock(block, chunks[task].coordinates.data());
+        });
+        for (int task = 0; task < numberOfBlocks; task++)
+            write(chunks[task]);
+    }
+}
+
+// Second pass: rows keep their file order inside each section, which matches the stable ordering of MshReader2D and MshReader3D
+void MshStreamReader::streamConnectivities(const std::function<void(const ConnectivityChunk&)>& write) {
+    int numberOfSections = this->sectionOffsets.size();
+    std::vector<GridIndex> cursors(this->sectionOffsets);
+    std::vector<int> chunkIndices(numberOfSections, -1);
+    std::vector<ConnectivityChunk> chunks;
+    GridIndex row = 0;
+
+    this->forEachElementBlock([&](const MshConnectivities& rows) {
+        chunks.clear();
+        for (GridIndex i = 0; i < rows.size(); i++, row++) {
+            int section = row < this->numberOfFacets ? this->numberOfRegions + rows.physicals[i] : this->physicalRegions[rows.physicals[i]];
+            if (chunkIndices[section] < 0) {
+                chunkIndices[section] = chunks.size();
+                chunks.push_back(ConnectivityChunk{section, cursors[section], {}, {}});
+            }
+
+            ConnectivityChunk& chunk = chunks[chunkIndices[section]];
+            chunk.sizes.push_back(rows.offsets[i+1] - rows.offsets[i]);
+            chunk.vertices.insert(chunk.vertices.end(), rows.vertices(i), rows.vertices(i) + chunk.sizes.back());
+            cursors[section]++;
+        }
+
+        for (const auto& chunk : chunks) {
+            write(chunk);
+            chunkIndices[chunk.section] = -1;
+        }
+    });
+}
+
+bool MshStreamReader::isFacet(int type) const {
+    return this->gridData->dimension == 3 ? type == 1 || type == 2 : type == 0;
+}
+
+bool MshStreamReader::isElement(int type) const {
+    return this->gridData->dimension == 3 ? type == 3 || type == 4 : type == 1 || type == 2;
+}
+
+void MshStreamReader::mergeElementSize(int& elementSize, int numberOfNodes) {
+    if (elementSize < 0)
+        elementSize = numberOfNodes;
+    else if (elementSize != numberOfNodes)
+        elementSize = 0;
+}
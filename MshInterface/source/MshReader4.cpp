@@ -0,0 +1,239 @@
+#include <MshInterface/MshReader4.hpp>
+
+MshReader4::MshReader4(const MshSections& sections, const MshFormat& format, int numberOfThreads) : sections(sections), format(format), numberOfThreads(numberOfThreads) {}
+
+const char* MshReader4::findBinarySectionEnd(const std::string& name, const char* position, const char* end) {
+    if (name == "Entities")
+        return this->readEntities(position, end);
+    else if (name == "Nodes")
+        return this->splitNodes(position, end);
+    else if (name == "Elements")
+        return this->splitElements(position, end);
+    else
+        return nullptr;
+}
+
+std::pair<const char*, const char*> MshReader4::findSection(std::string name) {
+    auto section = this->sections.find(name);
+    if (section == this->sections.cend())
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - There is no " + name + " data in the grid file");
+    return section->second;
+}
+
+int MshReader4::parseInt(const char*& position, const char* end) {
+    return this->format.binary ? parseBinary<int>(position, end, this->format.swapBytes) : parse<int>(position, end);
+}
+
+long MshReader4::parseSize(const char*& position, const char* end) {
+    if (!this->format.binary)
+        return parse<long>(position, end);
+    else if (this->format.dataSize == 8)
+        return parseBinary<std::uint64_t>(position, end, this->format.swapBytes);
+    else
+        return parseBinary<std::uint32_t>(position, end, this->format.swapBytes);
+}
+
+double MshReader4::parseDouble(const char*& position, const char* end) {
+    return this->format.binary ? parseBinary<double>(position, end, this->format.swapBytes) : parse<double>(position, end);
+}
+
+const char* MshReader4::readEntities(const char* position, const char* end) {
+    std::array<long, 4> numberOfEntities;
+    for (auto& number : numberOfEntities)
+        number = this->parseSize(position, end);
+
+    for (int dimension = 0; dimension < 4; dimension++) {
+        this->entitiesPhysicals[dimension].clear();
+        for (long i = 0; i < numberOfEntities[dimension]; i++) {
+            int tag = this->parseInt(position, end);
+            for (int j = 0; j < (dimension == 0 ? 3 : 6); j++)
+                this->parseDouble(position, end);
+
+            std::vector<int>& physicals = this->entitiesPhysicals[dimension][tag];
+            physicals.resize(this->parseSize(position, end));
+            for (auto& physical : physicals)
+                physical = std::abs(this->parseInt(position, end)) - 1;
+
+            if (dimension > 0) {
+                long numberOfBoundingEntities = this->parseSize(position, end);
+                for (long j = 0; j < numberOfBoundingEntities; j++)
+                    this->parseInt(position, end);
+            }
+        }
+    }
+    return position;
+}
+
+const char* MshReader4::splitNodes(const char* position, const char* end, int recordsPerBlock) {
+    this->tagBlocks.clear();
+    this->coordinateBlocks.clear();
+
+    long numberOfEntityBlocks = this->parseSize(position, end);
+    this->numberOfVertices = toGridIndex(this->parseSize(position, end));
+    this->parseSize(position, end);
+    this->maximumNodeTag = toGridIndex(this->parseSize(position, end));
+
+    GridIndex offset = 0;
+    for (long i = 0; i < numberOfEntityBlocks; i++) {
+        int dimension = this->parseInt(position, end);
+        this->parseInt(position, end);
+        int parametric = this->parseInt(position, end);
+        GridIndex numberOfNodesInBlock = toGridIndex(this->parseSize(position, end));
+
+        splitBlock(this->tagBlocks, MshBlock{nullptr, nullptr, numberOfNodesInBlock, offset, 0, this->format.dataSize, nullptr}, this->format.binary, position, end, recordsPerBlock);
+        int numberOfCoordinates = 3 + (parametric ? dimension : 0);
+        splitBlock(this->coordinateBlocks, MshBlock{nullptr, nullptr, numberOfNodesInBlock, offset, 0, numberOfCoordinates * int(sizeof(double)), nullptr}, this->format.binary, position, end, recordsPerBlock);
+        offset = toGridIndex(long(offset) + numberOfNodesInBlock);
+    }
+    if (offset != this->numberOfVertices)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Expected " + std::to_string(this->numberOfVertices) + " nodes and found " + std::to_string(offset));
+    return position;
+}
+
+const char* MshReader4::splitElements(const char* position, const char* end, int recordsPerBlock) {
+    this->elementBlocks.clear();
+
+    long numberOfEntityBlocks = this->parseSize(position, end);
+    for (int i = 0; i < 3; i++)
+        this->parseSize(position, end);
+
+    this->numberOfRows = 0;
+    for (long i = 0; i < numberOfEntityBlocks; i++) {
+        int dimension = this->parseInt(position, end);
+        int tag = this->parseInt(position, end);
+        int type = this->parseInt(position, end);
+        GridIndex numberOfElementsInBlock = toGridIndex(this->parseSize(position, end));
+
+        if (dimension < 0 || dimension > 3 || !this->entitiesPhysicals[dimension].count(tag))
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - There is no entity " + std::to_string(tag) + " of dimension " + std::to_string(dimension));
+        const std::vector<int>& physicals = this->entitiesPhysicals[dimension].at(tag);
+
+        GridIndex firstRow = this->numberOfRows;
+        this->numberOfRows = toGridIndex(long(this->numberOfRows) + long(numberOfElementsInBlock) * long(physicals.size()));
+        int recordSize = this->format.binary ? (1 + numberOfElementNodes(type)) * this->format.dataSize : 0;
+        splitBlock(this->elementBlocks, MshBlock{nullptr, nullptr, numberOfElementsInBlock, firstRow, type - 1, recordSize, &physicals}, this->format.binary, position, end, recordsPerBlock);
+    }
+    return position;
+}
+
+GridIndex MshReader4::nodeIndex(long tag) {
+    if (tag < 0 || tag >= long(this->nodeIndices.size()) || this->nodeIndices[tag] < 0)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - There is no node with tag " + std::to_string(tag));
+    return this->nodeIndices[tag];
+}
+
+void MshReader4::readNodeIndices() {
+    this->nodeIndices.assign(std::size_t(this->maximumNodeTag) + 1, -1);
+    parallelFor(this->tagBlocks.size(), this->numberOfThreads, [this](int task) {
+        const MshBlock& block = this->tagBlocks[task];
+        const char* position = block.begin;
+        for (GridIndex i = block.firstIndex; i < block.firstIndex + block.numberOfRecords; i++) {
+            const char* record = position;
+            long tag = this->parseSize(position, block.end);
+            if (tag < 0 || tag > this->maximumNodeTag)
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Node tag " + std::to_string(tag) + " is out of range");
+            this->nodeIndices[tag] = i;
+            position = this->format.binary ? record + block.recordSize : skipLine(position, block.end);
+        }
+    });
+}
+
+void MshReader4::readNodes(std::vector<std::array<double, 3>>& coordinates) {
+    auto section = this->findSection("Nodes");
+    this->splitNodes(section.first, section.second);
+    this->readNodeIndices();
+
+    coordinates.resize(this->numberOfVertices, std::array<double, 3>());
+    parallelFor(this->coordinateBlocks.size(), this->numberOfThreads, [&](int task) {
+        const MshBlock& block = this->coordinateBlocks[task];
+        this->readCoordinates(block, coordinates.data() + block.firstIndex);
+    });
+}
+
+const std::vector<MshBlock>& MshReader4::splitCoordinates(int recordsPerBlock) {
+    auto section = this->findSection("Nodes");
+    this->splitNodes(section.first, section.second, recordsPerBlock);
+    this->readNodeIndices();
+    return this->coordinateBlocks;
+}
+
+void MshReader4::readCoordinates(const MshBlock& block, std::array<double, 3>* coordinates) {
+    static_assert(sizeof(std::array<double, 3>) == 3 * sizeof(double), "Coordinates must be contiguous doubles");
+    if (this->format.binary && !this->format.swapBytes && block.recordSize == sizeof(std::array<double, 3>)) {
+        std::memcpy(coordinates->data(), block.begin, block.end - block.begin);
+        return;
+    }
+
+    const char* position = block.begin;
+    for (GridIndex i = 0; i < block.numberOfRecords; i++) {
+        const char* record = position;
+        coordinates[i][0] = this->parseDouble(position, block.end);
+        coordinates[i][1] = this->parseDouble(position, block.end);
+        coordinates[i][2] = this->parseDouble(position, block.end);
+        position = this->format.binary ? record + block.recordSize : skipLine(position, block.end);
+    }
+}
+
+void MshReader4::readConnectivities(MshConnectivities& connectivities) {
+    auto entities = this->findSection("Entities");
+    this->readEntities(entities.first, entities.second);
+
+    auto section = this->findSection("Elements");
+    this->splitElements(section.first, section.second);
+
+    connectivities.resize(this->numberOfRows);
+    for (const auto& block : this->elementBlocks) {
+        GridIndex row = block.firstIndex;
+        for (GridIndex i = 0; i < block.numberOfRecords; i++) {
+            for (int physical : *block.physicals) {
+                connectivities.types[row] = block.type;
+                connectivities.physicals[row++] = physical;
+            }
+        }
+    }
+    connectivities.computeOffsets();
+
+    parallelFor(this->elementBlocks.size(), this->numberOfThreads, [&](int task) {
+        const MshBlock& block = this->elementBlocks[task];
+        this->readElementRecords(block, connectivities.indices.data() + connectivities.offsets[block.firstIndex]);
+    });
+}
+
+const std::vector<MshBlock>& MshReader4::splitConnectivities(int recordsPerBlock) {
+    auto entities = this->findSection("Entities");
+    this->readEntities(entities.first, entities.second);
+
+    auto section = this->findSection("Elements");
+    this->splitElements(section.first, section.second, recordsPerBlock);
+    return this->elementBlocks;
+}
+
+void MshReader4::readConnectivities(const MshBlock& block, MshConnectivities& rows) {
+    const std::vector<int>& physicals = *block.physicals;
+    rows.resize(block.numberOfRecords * GridIndex(physicals.size()));
+    std::fill(rows.types.begin(), rows.types.end(), block.type);
+    for (GridIndex row = 0; row < rows.size(); row++)
+        rows.physicals[row] = physicals[row % physicals.size()];
+    rows.computeOffsets();
+    this->readElementRecords(block, rows.indices.data());
+}
+
+// Every row of a block has the same number of vertices, so the rows of a block are contiguous in the output
+void MshReader4::readElementRecords(const MshBlock& block, GridIndex* vertices) {
+    int numberOfNodes = numberOfElementNodes(block.type + 1);
+    int numberOfPhysicals = block.physicals->size();
+    const char* position = block.begin;
+    for (GridIndex i = 0; i < block.numberOfRecords; i++) {
+        position = this->format.binary ? position : skipBlanks(position, block.end);
+        const char* recordEnd = this->format.binary ? position + block.recordSize : findLineEnd(position, block.end);
+        this->parseSize(position, recordEnd);
+
+        for (int j = 0; j < numberOfNodes; j++)
+            vertices[j] = this->nodeIndex(this->parseSize(position, recordEnd));
+        for (int k = 1; k < numberOfPhysicals; k++)
+            std::copy_n(vertices, numberOfNodes, vertices + k * numberOfNodes);
+
+        vertices += numberOfPhysicals * numberOfNodes;
+        position = recordEnd;
+    }
+}
@@ -0,0 +1,51 @@
+#include <BoostInterface/Test.hpp>
+#include <MshInterface/DecompressionStream.hpp>
+#include <fstream>
+#include <sstream>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+TestCase(decompression_stream_delivers_whole_file_in_bounded_chunks) {
+    std::ifstream file(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/3D-Region1-ElementType1/14v_24e.msh", std::ios::binary);
+    std::stringstream plain;
+    plain << file.rdbuf();
+
+    DecompressionStream stream(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/3D-Region1-ElementType1-Compressed/14v_24e.msh.gz", 7, 2);
+    std::string chunk, decompressed;
+    while (stream.read(chunk)) {
+        check(chunk.size() <= 7u);
+        decompressed.append(chunk);
+    }
+
+    check(decompressed == plain.str());
+}
+
+TestCase(decompression_stream_rejects_plain_files) {
+    BOOST_CHECK_THROW(DecompressionStream(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/3D-Region1-ElementType1/14v_24e.msh"), std::runtime_error);
+}
+
+#ifdef HAVE_ZSTD
+TestCase(decompression_stream_flushes_zstd_output_held_after_the_last_input) {
+    std::string plain;
+    for (std::size_t line = 0; plain.size() < 4 * ZSTD_DStreamOutSize(); line++)
+        plain += std::to_string(line % 1000) + " 0.0 0.0 0.0\n";
+
+    std::string compressed(ZSTD_compressBound(plain.size()), '\0');
+    compressed.resize(ZSTD_compress(&compressed[0], compressed.size(), plain.data(), plain.size(), 19));
+    check(compressed.size() < ZSTD_DStreamInSize());
+
+    std::string filePath = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%.msh.zst")).string();
+    std::ofstream(filePath, std::ios::binary) << compressed;
+
+    std::string chunk, decompressed;
+    {
+        DecompressionStream stream(filePath, ZSTD_DStreamOutSize(), 2);
+        while (stream.read(chunk))
+            decompressed.append(chunk);
+    }
+    boost::filesystem::remove(filePath);
+
+    check(decompressed == plain);
+}
+#endif
@@ -0,0 +1,57 @@
+#include <BoostInterface/Test.hpp>
+#include <MshInterface/MshReader/MshReader2D.hpp>
+
+struct Region4_ElementType1_2D_Msh4 {
+    Region4_ElementType1_2D_Msh4() {
+        MshReader2D msh2Reader(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/2D-Region4-ElementType1/11v_10e.msh");
+        this->msh2 = msh2Reader.gridData;
+
+        MshReader2D msh4Reader(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/2D-Region4-ElementType1-Msh4/11v_10e.msh", 3);
+        this->msh4 = msh4Reader.gridData;
+    }
+
+    ~Region4_ElementType1_2D_Msh4() = default;
+
+    boost::shared_ptr<GridData> msh2;
+    boost::shared_ptr<GridData> msh4;
+};
+
+FixtureTestSuite(ReadMsh_Region4_ElementType1_2D_Msh4, Region4_ElementType1_2D_Msh4)
+
+TestCase(Coordinates) {
+    checkEqual(this->msh4->coordinates.size(), 11u);
+    check(this->msh4->coordinates == this->msh2->coordinates);
+}
+
+TestCase(Elements) {
+    checkEqual(this->msh4->triangleConnectivity.size(), 8u);
+    check(this->msh4->triangleConnectivity == this->msh2->triangleConnectivity);
+    checkEqual(this->msh4->quadrangleConnectivity.size(), 2u);
+    check(this->msh4->quadrangleConnectivity == this->msh2->quadrangleConnectivity);
+}
+
+TestCase(Facets) {
+    checkEqual(this->msh4->lineConnectivity.size(), 8u);
+    check(this->msh4->lineConnectivity == this->msh2->lineConnectivity);
+}
+
+TestCase(Regions) {
+    checkEqual(this->msh4->regions.size(), this->msh2->regions.size());
+    for (unsigned i = 0; i < this->msh2->regions.size(); i++) {
+        check(this->msh4->regions[i].name == this->msh2->regions[i].name);
+        checkEqual(this->msh4->regions[i].elementBegin, this->msh2->regions[i].elementBegin);
+        checkEqual(this->msh4->regions[i].elementEnd, this->msh2->regions[i].elementEnd);
+    }
+}
+
+TestCase(Boundaries) {
+    checkEqual(this->msh4->boundaries.size(), this->msh2->boundaries.size());
+    for (unsigned i = 0; i < this->msh2->boundaries.size(); i++) {
+        check(this->msh4->boundaries[i].name == this->msh2->boundaries[i].name);
+        checkEqual(this->msh4->boundaries[i].facetBegin, this->msh2->boundaries[i].facetBegin);
+        checkEqual(this->msh4->boundaries[i].facetEnd, this->msh2->boundaries[i].facetEnd);
+        check(this->msh4->boundaries[i].vertices == this->msh2->boundaries[i].vertices);
+    }
+}
+
+TestSuiteEnd()
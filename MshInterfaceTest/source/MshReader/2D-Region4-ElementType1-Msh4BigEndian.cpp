@@ -0,0 +1,57 @@
+#include <BoostInterface/Test.hpp>
+#include <MshInterface/MshReader/MshReader2D.hpp>
+
+struct Region4_ElementType1_2D_Msh4BigEndian {
+    Region4_ElementType1_2D_Msh4BigEndian() {
+        MshReader2D asciiReader(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/2D-Region4-ElementType1/11v_10e.msh");
+        this->ascii = asciiReader.gridData;
+
+        MshReader2D binaryReader(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/2D-Region4-ElementType1-Msh4BigEndian/11v_10e.msh", 3);
+        this->binary = binaryReader.gridData;
+    }
+
+    ~Region4_ElementType1_2D_Msh4BigEndian() = default;
+
+    boost::shared_ptr<GridData> ascii;
+    boost::shared_ptr<GridData> binary;
+};
+
+FixtureTestSuite(ReadMsh_Region4_ElementType1_2D_Msh4BigEndian, Region4_ElementType1_2D_Msh4BigEndian)
+
+TestCase(Coordinates) {
+    checkEqual(this->binary->coordinates.size(), 11u);
+    check(this->binary->coordinates == this->ascii->coordinates);
+}
+
+TestCase(Elements) {
+    checkEqual(this->binary->triangleConnectivity.size(), 8u);
+    check(this->binary->triangleConnectivity == this->ascii->triangleConnectivity);
+    checkEqual(this->binary->quadrangleConnectivity.size(), 2u);
+    check(this->binary->quadrangleConnectivity == this->ascii->quadrangleConnectivity);
+}
+
+TestCase(Facets) {
+    checkEqual(this->binary->lineConnectivity.size(), 8u);
+    check(this->binary->lineConnectivity == this->ascii->lineConnectivity);
+}
+
+TestCase(Regions) {
+    checkEqual(this->binary->regions.size(), this->ascii->regions.size());
+    for (unsigned i = 0; i < this->ascii->regions.size(); i++) {
+        check(this->binary->regions[i].name == this->ascii->regions[i].name);
+        checkEqual(this->binary->regions[i].elementBegin, this->ascii->regions[i].elementBegin);
+        checkEqual(this->binary->regions[i].elementEnd, this->ascii->regions[i].elementEnd);
+    }
+}
+
+TestCase(Boundaries) {
+    checkEqual(this->binary->boundaries.size(), this->ascii->boundaries.size());
+    for (unsigned i = 0; i < this->ascii->boundaries.size(); i++) {
+        check(this->binary->boundaries[i].name == this->ascii->boundaries[i].name);
+        checkEqual(this->binary->boundaries[i].facetBegin, this->ascii->boundaries[i].facetBegin);
+        checkEqual(this->binary->boundaries[i].facetEnd, this->ascii->boundaries[i].facetEnd);
+        check(this->binary->boundaries[i].vertices == this->ascii->boundaries[i].vertices);
+    }
+}
+
+TestSuiteEnd()
@@ -0,0 +1,86 @@
+#include <map>
+#include <BoostInterface/Test.hpp>
+#include <MshInterface/MshReader/MshReader2D.hpp>
+#include <MshInterface/MshReader/MshStreamReader.hpp>
+
+struct Region4_ElementType1_2D_Stream {
+    Region4_ElementType1_2D_Stream() {
+        MshReader2D reader(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/2D-Region4-ElementType1/11v_10e.msh");
+        this->gridData = reader.gridData;
+
+        MshStreamReader streamReader(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/2D-Region4-ElementType1-Msh4/11v_10e.msh", 2, 3, 2);
+        this->streamed = streamReader.getGridData();
+        for (int i = 0; i < 8; i++)
+            this->elementSizes.push_back(streamReader.getSectionElementSize(i));
+
+        this->coordinates.resize(streamReader.getNumberOfVertices());
+        streamReader.streamCoordinates([this](const CoordinateChunk& chunk) {
+            std::copy(chunk.coordinates.cbegin(), chunk.coordinates.cend(), this->coordinates.begin() + chunk.begin);
+        });
+        streamReader.streamConnectivities([this](const ConnectivityChunk& chunk) {
+            auto vertices = chunk.vertices.cbegin();
+            for (unsigned i = 0; i < chunk.sizes.size(); i++) {
+                this->sections[chunk.begin + i] = chunk.section;
+                this->connectivities[chunk.begin + i].assign(vertices, vertices + chunk.sizes[i]);
+                vertices += chunk.sizes[i];
+            }
+        });
+    }
+
+    ~Region4_ElementType1_2D_Stream() = default;
+
+    boost::shared_ptr<GridData> gridData;
+    boost::shared_ptr<GridData> streamed;
+    std::vector<int> elementSizes;
+    std::vector<std::array<double, 3>> coordinates;
+    std::map<int, int> sections;
+    std::map<int, std::vector<int>> connectivities;
+};
+
+FixtureTestSuite(ReadMsh_Region4_ElementType1_2D_Stream, Region4_ElementType1_2D_Stream)
+
+TestCase(Coordinates) {
+    checkEqual(this->coordinates.size(), 11u);
+    check(this->coordinates == this->gridData->coordinates);
+}
+
+TestCase(Regions) {
+    checkEqual(this->streamed->regions.size(), 4u);
+    for (unsigned i = 0; i < this->gridData->regions.size(); i++) {
+        checkEqual(this->streamed->regions[i].name, this->gridData->regions[i].name);
+        checkEqual(this->streamed->regions[i].elementBegin, this->gridData->regions[i].elementBegin);
+        checkEqual(this->streamed->regions[i].elementEnd, this->gridData->regions[i].elementEnd);
+    }
+    checkEqual(this->elementSizes[0], 4);
+    checkEqual(this->elementSizes[1], 3);
+    checkEqual(this->elementSizes[2], 4);
+    checkEqual(this->elementSizes[3], 3);
+}
+
+TestCase(Boundaries) {
+    checkEqual(this->streamed->boundaries.size(), 4u);
+    for (unsigned i = 0; i < this->gridData->boundaries.size(); i++) {
+        checkEqual(this->streamed->boundaries[i].name, this->gridData->boundaries[i].name);
+        checkEqual(this->streamed->boundaries[i].facetBegin, this->gridData->boundaries[i].facetBegin);
+        checkEqual(this->streamed->boundaries[i].facetEnd, this->gridData->boundaries[i].facetEnd);
+        check(this->streamed->boundaries[i].vertices == this->gridData->boundaries[i].vertices);
+        checkEqual(this->elementSizes[4 + i], 2);
+    }
+}
+
+TestCase(Connectivities) {
+    checkEqual(this->connectivities.size(), 18u);
+
+    for (const auto& triangle : this->gridData->triangleConnectivity)
+        check(this->connectivities[triangle.back()] == std::vector<int>(triangle.cbegin(), triangle.cend() - 1));
+
+    for (const auto& quadrangle : this->gridData->quadrangleConnectivity)
+        check(this->connectivities[quadrangle.back()] == std::vector<int>(quadrangle.cbegin(), quadrangle.cend() - 1));
+
+    for (const auto& line : this->gridData->lineConnectivity) {
+        check(this->sections[line.back()] >= 4);
+        check(this->connectivities[line.back()] == std::vector<int>(line.cbegin(), line.cend() - 1));
+    }
+}
+
+TestSuiteEnd()
@@ -0,0 +1,42 @@
+#include <BoostInterface/Test.hpp>
+#include <MshInterface/MshReader/MshReader3D.hpp>
+
+struct Region1_ElementType1_3D_Compressed {
+    Region1_ElementType1_3D_Compressed() {
+        MshReader3D plainReader(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/3D-Region1-ElementType1/14v_24e.msh");
+        this->plain = plainReader.gridData;
+
+        MshReader3D gzipReader(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/3D-Region1-ElementType1-Compressed/14v_24e.msh.gz");
+        this->gzip = gzipReader.gridData;
+    }
+
+    ~Region1_ElementType1_3D_Compressed() = default;
+
+    boost::shared_ptr<GridData> plain;
+    boost::shared_ptr<GridData> gzip;
+};
+
+FixtureTestSuite(ReadMsh_Region1_ElementType1_3D_Compressed, Region1_ElementType1_3D_Compressed)
+
+TestCase(Gzip) {
+    checkEqual(this->gzip->coordinates.size(), 14u);
+    check(this->gzip->coordinates == this->plain->coordinates);
+    check(this->gzip->tetrahedronConnectivity == this->plain->tetrahedronConnectivity);
+    check(this->gzip->triangleConnectivity == this->plain->triangleConnectivity);
+    checkEqual(this->gzip->boundaries.size(), this->plain->boundaries.size());
+    for (unsigned i = 0; i < this->plain->boundaries.size(); i++)
+        check(this->gzip->boundaries[i].vertices == this->plain->boundaries[i].vertices);
+}
+
+#ifdef HAVE_ZSTD
+TestCase(Zstd) {
+    MshReader3D zstdReader(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/3D-Region1-ElementType1-Compressed/14v_24e.msh.zst");
+    auto zstd = zstdReader.gridData;
+
+    check(zstd->coordinates == this->plain->coordinates);
+    check(zstd->tetrahedronConnectivity == this->plain->tetrahedronConnectivity);
+    check(zstd->triangleConnectivity == this->plain->triangleConnectivity);
+}
+#endif
+
+TestSuiteEnd()
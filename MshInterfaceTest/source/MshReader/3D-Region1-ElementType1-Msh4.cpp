@@ -0,0 +1,65 @@
+#include <BoostInterface/Test.hpp>
+#include <MshInterface/MshReader/MshReader3D.hpp>
+
+struct Region1_ElementType1_3D_Msh4 {
+    Region1_ElementType1_3D_Msh4() {
+        MshReader3D msh2Reader(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/3D-Region1-ElementType1/14v_24e.msh");
+        this->msh2 = msh2Reader.gridData;
+
+        MshReader3D msh4Reader(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/3D-Region1-ElementType1-Msh4/14v_24e.msh", 3);
+        this->msh4 = msh4Reader.gridData;
+    }
+
+    ~Region1_ElementType1_3D_Msh4() = default;
+
+    boost::shared_ptr<GridData> msh2;
+    boost::shared_ptr<GridData> msh4;
+};
+
+FixtureTestSuite(ReadMsh_Region1_ElementType1_3D_Msh4, Region1_ElementType1_3D_Msh4)
+
+TestCase(Coordinates) {
+    checkEqual(this->msh4->coordinates.size(), 14u);
+    check(this->msh4->coordinates == this->msh2->coordinates);
+}
+
+TestCase(Elements) {
+    checkEqual(this->msh4->tetrahedronConnectivity.size(), 24u);
+    check(this->msh4->tetrahedronConnectivity == this->msh2->tetrahedronConnectivity);
+}
+
+TestCase(Facets) {
+    checkEqual(this->msh4->triangleConnectivity.size(), 24u);
+    check(this->msh4->triangleConnectivity == this->msh2->triangleConnectivity);
+}
+
+TestCase(Regions) {
+    checkEqual(this->msh4->regions.size(), this->msh2->regions.size());
+    for (unsigned i = 0; i < this->msh2->regions.size(); i++) {
+        check(this->msh4->regions[i].name == this->msh2->regions[i].name);
+        checkEqual(this->msh4->regions[i].elementBegin, this->msh2->regions[i].elementBegin);
+        checkEqual(this->msh4->regions[i].elementEnd, this->msh2->regions[i].elementEnd);
+    }
+}
+
+TestCase(Boundaries) {
+    checkEqual(this->msh4->boundaries.size(), this->msh2->boundaries.size());
+    for (unsigned i = 0; i < this->msh2->boundaries.size(); i++) {
+        check(this->msh4->boundaries[i].name == this->msh2->boundaries[i].name);
+        checkEqual(this->msh4->boundaries[i].facetBegin, this->msh2->boundaries[i].facetBegin);
+        checkEqual(this->msh4->boundaries[i].facetEnd, this->msh2->boundaries[i].facetEnd);
+        check(this->msh4->boundaries[i].vertices == this->msh2->boundaries[i].vertices);
+    }
+}
+
+TestSuiteEnd()
+
+TestCase(msh_counts_must_fit_in_grid_indices) {
+    checkEqual(toGridIndex(14), 14);
+    BOOST_CHECK_THROW(toGridIndex(-1), std::runtime_error);
+    long beyond32Bit = 1l << 31;
+    if (sizeof(GridIndex) == 4)
+        BOOST_CHECK_THROW(toGridIndex(beyond32Bit), std::runtime_error);
+    else
+        checkEqual(long(toGridIndex(beyond32Bit)), beyond32Bit);
+}
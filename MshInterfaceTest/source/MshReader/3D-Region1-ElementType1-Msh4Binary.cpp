@@ -0,0 +1,55 @@
+#include <BoostInterface/Test.hpp>
+#include <MshInterface/MshReader/MshReader3D.hpp>
+
+struct Region1_ElementType1_3D_Msh4Binary {
+    Region1_ElementType1_3D_Msh4Binary() {
+        MshReader3D asciiReader(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/3D-Region1-ElementType1/14v_24e.msh");
+        this->ascii = asciiReader.gridData;
+
+        MshReader3D binaryReader(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/3D-Region1-ElementType1-Msh4Binary/14v_24e.msh", 3);
+        this->binary = binaryReader.gridData;
+    }
+
+    ~Region1_ElementType1_3D_Msh4Binary() = default;
+
+    boost::shared_ptr<GridData> ascii;
+    boost::shared_ptr<GridData> binary;
+};
+
+FixtureTestSuite(ReadMsh_Region1_ElementType1_3D_Msh4Binary, Region1_ElementType1_3D_Msh4Binary)
+
+TestCase(Coordinates) {
+    checkEqual(this->binary->coordinates.size(), 14u);
+    check(this->binary->coordinates == this->ascii->coordinates);
+}
+
+TestCase(Elements) {
+    checkEqual(this->binary->tetrahedronConnectivity.size(), 24u);
+    check(this->binary->tetrahedronConnectivity == this->ascii->tetrahedronConnectivity);
+}
+
+TestCase(Facets) {
+    checkEqual(this->binary->triangleConnectivity.size(), 24u);
+    check(this->binary->triangleConnectivity == this->ascii->triangleConnectivity);
+}
+
+TestCase(Regions) {
+    checkEqual(this->binary->regions.size(), this->ascii->regions.size());
+    for (unsigned i = 0; i < this->ascii->regions.size(); i++) {
+        check(this->binary->regions[i].name == this->ascii->regions[i].name);
+        checkEqual(this->binary->regions[i].elementBegin, this->ascii->regions[i].elementBegin);
+        checkEqual(this->binary->regions[i].elementEnd, this->ascii->regions[i].elementEnd);
+    }
+}
+
+TestCase(Boundaries) {
+    checkEqual(this->binary->boundaries.size(), this->ascii->boundaries.size());
+    for (unsigned i = 0; i < this->ascii->boundaries.size(); i++) {
+        check(this->binary->boundaries[i].name == this->ascii->boundaries[i].name);
+        checkEqual(this->binary->boundaries[i].facetBegin, this->ascii->boundaries[i].facetBegin);
+        checkEqual(this->binary->boundaries[i].facetEnd, this->ascii->boundaries[i].facetEnd);
+        check(this->binary->boundaries[i].vertices == this->ascii->boundaries[i].vertices);
+    }
+}
+
+TestSuiteEnd()
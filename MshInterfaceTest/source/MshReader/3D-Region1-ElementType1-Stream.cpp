@@ -0,0 +1,105 @@
+#include <map>
+#include <BoostInterface/Test.hpp>
+#include <MshInterface/MshReader/MshReader3D.hpp>
+#include <MshInterface/MshReader/MshStreamReader.hpp>
+
+struct Region1_ElementType1_3D_Stream {
+    Region1_ElementType1_3D_Stream() {
+        MshReader3D reader(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/3D-Region1-ElementType1/14v_24e.msh");
+        this->gridData = reader.gridData;
+
+        MshStreamReader streamReader(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/3D-Region1-ElementType1/14v_24e.msh", 3, 5, 3);
+        this->streamed = streamReader.getGridData();
+        this->elementSizes = {streamReader.getSectionElementSize(0), streamReader.getSectionElementSize(1)};
+
+        this->coordinates.resize(streamReader.getNumberOfVertices());
+        streamReader.streamCoordinates([this](const CoordinateChunk& chunk) {
+            std::copy(chunk.coordinates.cbegin(), chunk.coordinates.cend(), this->coordinates.begin() + chunk.begin);
+            this->numberOfCoordinateChunks++;
+        });
+        streamReader.streamConnectivities([this](const ConnectivityChunk& chunk) {
+            this->largestChunk = std::max(this->largestChunk, int(chunk.sizes.size()));
+            auto vertices = chunk.vertices.cbegin();
+            for (unsigned i = 0; i < chunk.sizes.size(); i++) {
+                this->sections[chunk.begin + i] = chunk.section;
+                this->connectivities[chunk.begin + i].assign(vertices, vertices + chunk.sizes[i]);
+                vertices += chunk.sizes[i];
+            }
+        });
+
+        for (std::string directory : {"3D-Region1-ElementType1-Binary", "3D-Region1-ElementType1-Msh4Binary"}) {
+            MshStreamReader binaryReader(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/" + directory + "/14v_24e.msh", 3, 7, 2);
+            std::map<int, std::vector<int>>& binaryConnectivities = this->binaryConnectivities[directory];
+            binaryReader.streamConnectivities([&](const ConnectivityChunk& chunk) {
+                auto vertices = chunk.vertices.cbegin();
+                for (unsigned i = 0; i < chunk.sizes.size(); i++) {
+                    binaryConnectivities[chunk.begin + i].assign(vertices, vertices + chunk.sizes[i]);
+                    vertices += chunk.sizes[i];
+                }
+            });
+        }
+    }
+
+    ~Region1_ElementType1_3D_Stream() = default;
+
+    boost::shared_ptr<GridData> gridData;
+    boost::shared_ptr<GridData> streamed;
+    std::vector<int> elementSizes;
+    std::vector<std::array<double, 3>> coordinates;
+    std::map<int, int> sections;
+    std::map<int, std::vector<int>> connectivities;
+    std::map<std::string, std::map<int, std::vector<int>>> binaryConnectivities;
+    int numberOfCoordinateChunks = 0;
+    int largestChunk = 0;
+};
+
+FixtureTestSuite(ReadMsh_Region1_ElementType1_3D_Stream, Region1_ElementType1_3D_Stream)
+
+TestCase(Coordinates) {
+    checkEqual(this->coordinates.size(), 14u);
+    checkEqual(this->numberOfCoordinateChunks, 3);
+    check(this->coordinates == this->gridData->coordinates);
+}
+
+TestCase(Layout) {
+    checkEqual(this->streamed->dimension, 3);
+    checkEqual(this->streamed->regions.size(), 1u);
+    checkEqual(this->streamed->regions[0].name, this->gridData->regions[0].name);
+    checkEqual(this->streamed->regions[0].elementBegin, 0);
+    checkEqual(this->streamed->regions[0].elementEnd, 24);
+    checkEqual(this->elementSizes[0], 4);
+    checkEqual(this->elementSizes[1], 3);
+
+    checkEqual(this->streamed->boundaries.size(), this->gridData->boundaries.size());
+    for (unsigned i = 0; i < this->gridData->boundaries.size(); i++) {
+        checkEqual(this->streamed->boundaries[i].name, this->gridData->boundaries[i].name);
+        checkEqual(this->streamed->boundaries[i].facetBegin, this->gridData->boundaries[i].facetBegin);
+        checkEqual(this->streamed->boundaries[i].facetEnd, this->gridData->boundaries[i].facetEnd);
+        check(this->streamed->boundaries[i].vertices == this->gridData->boundaries[i].vertices);
+    }
+    check(this->streamed->coordinates.empty());
+    check(this->streamed->tetrahedronConnectivity.empty());
+}
+
+TestCase(Connectivities) {
+    checkEqual(this->connectivities.size(), 48u);
+    check(this->largestChunk <= 5);
+
+    for (const auto& tetrahedron : this->gridData->tetrahedronConnectivity) {
+        checkEqual(this->sections[tetrahedron.back()], 0);
+        check(this->connectivities[tetrahedron.back()] == std::vector<int>(tetrahedron.cbegin(), tetrahedron.cend() - 1));
+    }
+
+    for (const auto& triangle : this->gridData->triangleConnectivity) {
+        check(this->sections[triangle.back()] >= 1);
+        check(this->connectivities[triangle.back()] == std::vector<int>(triangle.cbegin(), triangle.cend() - 1));
+    }
+}
+
+TestCase(Binary) {
+    checkEqual(this->binaryConnectivities.size(), 2u);
+    for (const auto& binaryConnectivities : this->binaryConnectivities)
+        check(binaryConnectivities.second == this->connectivities);
+}
+
+TestSuiteEnd()
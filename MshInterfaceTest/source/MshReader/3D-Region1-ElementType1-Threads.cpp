@@ -0,0 +1,47 @@
+#include <BoostInterface/Test.hpp>
+#include <MshInterface/MshReader/MshReader3D.hpp>
+
+struct Region1_ElementType1_3D_Threads {
+    Region1_ElementType1_3D_Threads() {
+        MshReader3D serialReader(this->filePath, 1);
+        this->serial = serialReader.gridData;
+
+        MshReader3D parallelReader(this->filePath, 7);
+        this->parallel = parallelReader.gridData;
+    }
+
+    ~Region1_ElementType1_3D_Threads() = default;
+
+    std::string filePath = std::string(TEST_INPUT_DIRECTORY) + "MshInterface/3D-Region1-ElementType1/14v_24e.msh";
+    boost::shared_ptr<GridData> serial;
+    boost::shared_ptr<GridData> parallel;
+};
+
+FixtureTestSuite(ReadMsh_Region1_ElementType1_3D_Threads, Region1_ElementType1_3D_Threads)
+
+TestCase(Coordinates) {
+    checkEqual(this->parallel->coordinates.size(), 14u);
+    check(this->parallel->coordinates == this->serial->coordinates);
+}
+
+TestCase(Elements) {
+    checkEqual(this->parallel->tetrahedronConnectivity.size(), 24u);
+    check(this->parallel->tetrahedronConnectivity == this->serial->tetrahedronConnectivity);
+}
+
+TestCase(Facets) {
+    checkEqual(this->parallel->triangleConnectivity.size(), 24u);
+    check(this->parallel->triangleConnectivity == this->serial->triangleConnectivity);
+}
+
+TestCase(Boundaries) {
+    checkEqual(this->parallel->boundaries.size(), this->serial->boundaries.size());
+    for (unsigned i = 0; i < this->serial->boundaries.size(); i++) {
+        check(this->parallel->boundaries[i].name == this->serial->boundaries[i].name);
+        checkEqual(this->parallel->boundaries[i].facetBegin, this->serial->boundaries[i].facetBegin);
+        checkEqual(this->parallel->boundaries[i].facetEnd, this->serial->boundaries[i].facetEnd);
+        check(this->parallel->boundaries[i].vertices == this->serial->boundaries[i].vertices);
+    }
+}
+
+TestSuiteEnd()
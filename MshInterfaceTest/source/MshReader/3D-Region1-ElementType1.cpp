@@ -1,5 +1,8 @@
 #include <BoostInterface/Test.hpp>
 #include <MshInterface/MshReader/MshReader3D.hpp>
+#include <fstream>
+#include <iterator>
+#include <sstream>
 
 #define TOLERANCE 1e-12
 
@@ -216,3 +219,39 @@ TestCase(Top) {
 }
 
 TestSuiteEnd()
+
+// Element numbers and elementary tags are only skipped, but must still be read as GridIndex
+TestCase(msh_element_tags_beyond_32_bits) {
+    std::ifstream input(std::string(TEST_INPUT_DIRECTORY) + "MshInterface/3D-Region1-ElementType1/14v_24e.msh");
+    std::string filePath = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%.msh")).string();
+    std::ofstream output(filePath);
+    long beyond32Bit = 1l << 31;
+    bool elements = false;
+    for (std::string line; std::getline(input, line);) {
+        std::istringstream fields(line);
+        std::vector<long> values{std::istream_iterator<long>(fields), std::istream_iterator<long>()};
+        if (line == "$EndElements")
+            elements = false;
+        if (elements && values.size() > 5) {
+            values[0] += beyond32Bit;
+            values[4] += beyond32Bit;
+            line.clear();
+            for (long value : values)
+                line += std::to_string(value) + " ";
+        }
+        if (line == "$Elements")
+            elements = true;
+        output << line << "\n";
+    }
+    output.close();
+
+    if (sizeof(GridIndex) == 4)
+        BOOST_CHECK_THROW(MshReader3D{filePath}, std::runtime_error);
+    else {
+        MshReader3D mshReader3D(filePath);
+        checkEqual(mshReader3D.gridData->tetrahedronConnectivity.size(), 24u);
+        checkEqual(mshReader3D.gridData->tetrahedronConnectivity[0][0], 13);
+        checkEqual(mshReader3D.gridData->tetrahedronConnectivity[0][4], 0);
+    }
+    boost::filesystem::remove(filePath);
+}
@@ -3,6 +3,7 @@
 #include <BoostInterface/PropertyTree.hpp>
 #include <Utilities/Print.hpp>
 #include <Grid/GridData.hpp>
+#include <Grid/GridSnapshot.hpp>
 #include <MshInterface/MshReader/MshReader3D.hpp>
 #include <CgnsInterface/CgnsReader/CgnsReader3D.hpp>
 #include <CgnsInterface/CgnsCreator/CgnsCreator3D.hpp>
@@ -20,14 +21,10 @@ int main() {
     auto start = std::chrono::steady_clock::now();
 
     boost::shared_ptr<GridData> gridData;
-    if (inputPath.extension() == std::string(".msh")) {
-        MshReader3D reader(inputPath.string());
-        gridData = reader.gridData;
-    }
-    else if (inputPath.extension() == std::string(".cgns")) {
-        CgnsReader3D reader(inputPath.string());
-        gridData = reader.gridData;
-    }
+    if (inputPath.extension() == std::string(".msh"))
+        gridData = readThroughSnapshot(script, inputPath.string(), "MshReader3D", [&]() {return MshReader3D(inputPath.string()).gridData;});
+    else if (inputPath.extension() == std::string(".cgns"))
+        gridData = readThroughSnapshot(script, inputPath.string(), "CgnsReader3D", [&]() {return CgnsReader3D(inputPath.string()).gridData;});
     else
         throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - file extension " + inputPath.extension().string() + " not supported");
 
@@ -40,17 +37,17 @@ int main() {
     printGridDataInformation(gridData, "original");
     printf("\t#############################\n\n");
 
-    GridDataExtractor gridDataExtractor(gridData, std::string(SCRIPT_DIRECTORY) + "ScriptGridDataExtractor.json");
+    GridDataView reservoir = extractView(gridData, std::string(SCRIPT_DIRECTORY) + "ScriptGridDataExtractor.json");
 
-    std::vector<boost::shared_ptr<GridData>> gridDatas{gridData, gridDataExtractor.extract};
+    std::vector<GridDataView> views{GridDataView(gridData), reservoir};
     std::vector<std::string> baseNames{"Rock", "Reservoir"};
 
-    printGridDataInformation(gridDatas.back(), "reservoir");
+    std::cout << std::endl << "\treservoir: " << reservoir.getNumberOfVertices() << " vertices, " << reservoir.getNumberOfElements() << " elements" << std::endl;
     printf("\t#############################\n");
 
     start = std::chrono::steady_clock::now();
-    CgnsCreator3D creator(gridDataExtractor.extract, outputPath.string());
-    // MultipleBasesCgnsCreator3D(gridDatas, baseNames, outputPath.string());
+    CgnsCreator3D creator(reservoir, outputPath.string());
+    // MultipleBasesCgnsCreator3D(views, baseNames, outputPath.string());
     end = std::chrono::steady_clock::now();
 
     elapsedSeconds = end - start;
@@ -0,0 +1,53 @@
+#include <BoostInterface/Test.hpp>
+#include <Grid/GridDataSoA.hpp>
+
+TestCase(structure_of_arrays_separates_global_indices) {
+    GridData gridData;
+    gridData.dimension = 2;
+    gridData.coordinates = {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {1.0, 1.0, 0.0}, {0.0, 1.0, 0.0}};
+    gridData.triangleConnectivity = {{0, 1, 2, 1}, {0, 2, 3, 2}};
+    gridData.quadrangleConnectivity = {{0, 1, 2, 3, 0}};
+    gridData.lineConnectivity = {{0, 1, 3}, {1, 2, 4}};
+    gridData.regions = {RegionData{"Body", 0, 3}};
+    gridData.boundaries = {BoundaryData{"South", 3, 4, {0, 1}}, BoundaryData{"East", 4, 5, {1, 2}}};
+
+    auto gridDataSoA = toStructureOfArrays(gridData);
+    check(gridDataSoA->coordinatesX == std::vector<double>({0.0, 1.0, 1.0, 0.0}));
+    check(gridDataSoA->coordinatesY == std::vector<double>({0.0, 0.0, 1.0, 1.0}));
+    check(gridDataSoA->coordinatesZ == std::vector<double>(4, 0.0));
+
+    checkEqual(gridDataSoA->triangleConnectivity.size(), 2);
+    check(gridDataSoA->triangleConnectivity.vertices == std::vector<GridIndex>({0, 1, 2, 0, 2, 3}));
+    check(gridDataSoA->triangleConnectivity.indices == std::vector<GridIndex>({1, 2}));
+    checkEqual(gridDataSoA->triangleConnectivity.element(1)[2], 3);
+    check(gridDataSoA->quadrangleConnectivity.vertices == std::vector<GridIndex>({0, 1, 2, 3}));
+    check(gridDataSoA->lineConnectivity.indices == std::vector<GridIndex>({3, 4}));
+    checkEqual(gridDataSoA->tetrahedronConnectivity.size(), 0);
+    checkEqual(gridDataSoA->boundaries[1].name, "East");
+
+    auto roundTrip = toArrayOfStructures(*gridDataSoA);
+    checkEqual(roundTrip->dimension, 2);
+    check(roundTrip->coordinates == gridData.coordinates);
+    check(roundTrip->triangleConnectivity == gridData.triangleConnectivity);
+    check(roundTrip->quadrangleConnectivity == gridData.quadrangleConnectivity);
+    check(roundTrip->lineConnectivity == gridData.lineConnectivity);
+    checkEqual(roundTrip->regions[0].elementEnd, 3);
+    check(roundTrip->boundaries[0].vertices == gridData.boundaries[0].vertices);
+}
+
+TestCase(array_of_structures_requires_matching_coordinates) {
+    GridDataSoA gridDataSoA;
+    gridDataSoA.coordinatesX = {0.0, 1.0};
+    gridDataSoA.coordinatesY = {0.0};
+    gridDataSoA.coordinatesZ = {0.0, 1.0};
+    BOOST_CHECK_THROW(toArrayOfStructures(gridDataSoA), std::runtime_error);
+}
+
+TestCase(gather_coordinates_splits_a_range_of_vertices) {
+    std::vector<std::array<double, 3>> coordinates{{0.0, 1.0, 2.0}, {3.0, 4.0, 5.0}, {6.0, 7.0, 8.0}, {9.0, 10.0, 11.0}};
+    GridDataSoA gridDataSoA;
+    gatherCoordinates(1, 3, [&](GridIndex vertex) -> const std::array<double, 3>& {return coordinates[vertex];}, gridDataSoA);
+    check(gridDataSoA.coordinatesX == std::vector<double>({3.0, 6.0}));
+    check(gridDataSoA.coordinatesY == std::vector<double>({4.0, 7.0}));
+    check(gridDataSoA.coordinatesZ == std::vector<double>({5.0, 8.0}));
+}
@@ -0,0 +1,83 @@
+#include <BoostInterface/Test.hpp>
+#include <Grid/GridDataView.hpp>
+
+struct GridDataViewFixture {
+    GridDataViewFixture() {
+        this->gridData->dimension = 3;
+        this->gridData->coordinates = {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}, {1.0, 1.0, 1.0}, {2.0, 2.0, 2.0}};
+        this->gridData->tetrahedronConnectivity = {{0, 1, 2, 3, 0}, {1, 2, 3, 4, 1}};
+        this->gridData->pyramidConnectivity = {{1, 2, 4, 5, 3, 2}};
+        this->gridData->triangleConnectivity = {{0, 1, 2, 3}, {1, 2, 4, 4}};
+        this->gridData->lineConnectivity = {{3, 4, 5}};
+        this->gridData->regions = {RegionData{"Left", 0, 2}, RegionData{"Right", 2, 3}};
+        this->gridData->boundaries = {BoundaryData{"Bottom", 3, 4, {0, 1, 2}}, BoundaryData{"Top", 4, 5, {1, 2, 4}}};
+        this->gridData->wells = {WellData{"Well", 5, 6, {3, 4}}};
+    }
+
+    boost::shared_ptr<GridData> gridData = boost::make_shared<GridData>();
+};
+
+FixtureTestSuite(GridDataViewSuite, GridDataViewFixture)
+
+TestCase(whole_view_keeps_the_parent_numbering) {
+    GridDataView view(this->gridData);
+
+    checkEqual(view.getNumberOfVertices(), 6);
+    checkEqual(view.getNumberOfElements(), 6);
+    checkEqual(view.getLocalVertex(5), 5);
+    for (GridIndex element = 0; element < 6; element++)
+        checkEqual(view.getLocalElement(element), element);
+    check(view.getLayout()->coordinates.empty());
+    checkEqual(view.getLayout()->boundaries[1].facetBegin, 4);
+}
+
+TestCase(named_view_references_only_the_selected_entities) {
+    GridDataView view(this->gridData, {"Right"}, {"Top"}, {"Well"});
+
+    checkEqual(view.getNumberOfVertices(), 5);
+    checkEqual(view.getNumberOfElements(), 3);
+    check(view.getCoordinate(4) == this->gridData->coordinates[5]);
+    checkEqual(view.getLocalVertex(4), 3);
+    BOOST_CHECK_THROW(view.getLocalVertex(0), std::runtime_error);
+
+    checkEqual(view.getLocalElement(0), -1);
+    checkEqual(view.getLocalElement(2), 0);
+    checkEqual(view.getLocalElement(3), -1);
+    checkEqual(view.getLocalElement(4), 1);
+    checkEqual(view.getLocalElement(5), 2);
+    checkEqual(view.getParentElement(1), 4);
+    BOOST_CHECK_THROW(view.getParentElement(3), std::runtime_error);
+
+    auto layout = view.getLayout();
+    checkEqual(layout->regions[0].elementEnd, 1);
+    checkEqual(layout->boundaries[0].facetBegin, 1);
+    checkEqual(layout->wells[0].lineBegin, 2);
+    check(layout->boundaries[0].vertices == std::vector<GridIndex>({0, 1, 3}));
+    check(layout->wells[0].vertices == std::vector<GridIndex>({2, 3}));
+
+    std::vector<std::vector<GridIndex>> elements(view.getNumberOfElements());
+    view.forEachElement([&](GridIndex element, const GridIndex* vertices, int numberOfVertices) {
+        for (int i = 0; i < numberOfVertices; i++)
+            elements[element].push_back(view.getLocalVertex(vertices[i]));
+    });
+    check(elements[0] == std::vector<GridIndex>({0, 1, 3, 4, 2}));
+    check(elements[1] == std::vector<GridIndex>({0, 1, 3}));
+    check(elements[2] == std::vector<GridIndex>({2, 3}));
+
+    std::vector<std::vector<GridIndex>> threaded(view.getNumberOfElements());
+    view.forEachElement([&](GridIndex element, const GridIndex* vertices, int numberOfVertices) {
+        for (int i = 0; i < numberOfVertices; i++)
+            threaded[element].push_back(view.getLocalVertex(vertices[i]));
+    }, 3);
+    check(threaded == elements);
+
+    checkEqual(this->gridData->boundaries.size(), 2u);
+    checkEqual(this->gridData->boundaries[1].vertices[2], 4);
+}
+
+TestCase(named_view_rejects_unknown_and_repeated_entities) {
+    BOOST_CHECK_THROW(GridDataView(this->gridData, {"Middle"}, {}, {}), std::runtime_error);
+    BOOST_CHECK_THROW(GridDataView(this->gridData, {"Left", "Left"}, {}, {}), std::runtime_error);
+}
+
+TestSuiteEnd()
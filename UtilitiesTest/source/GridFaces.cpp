@@ -0,0 +1,68 @@
+#include <BoostInterface/Test.hpp>
+#include <Grid/GridFaces.hpp>
+
+struct GridFacesFixture {
+    GridFacesFixture() {
+        this->gridData.dimension = 3;
+        for (int k = 0; k < 2; k++)
+            for (int j = 0; j < 2; j++)
+                for (int i = 0; i < 3; i++)
+                    this->gridData.coordinates.push_back({double(i), double(j), double(k)});
+
+        auto vertex = [](int i, int j, int k) {return GridIndex(i + 3 * j + 6 * k);};
+        for (int i = 0; i < 2; i++)
+            this->gridData.hexahedronConnectivity.push_back({vertex(i, 0, 0), vertex(i + 1, 0, 0), vertex(i + 1, 1, 0), vertex(i, 1, 0), vertex(i, 0, 1), vertex(i + 1, 0, 1), vertex(i + 1, 1, 1), vertex(i, 1, 1), GridIndex(i)});
+        this->gridData.quadrangleConnectivity = {{vertex(0, 0, 0), vertex(0, 1, 0), vertex(1, 1, 0), vertex(1, 0, 0), 2}, {vertex(2, 0, 0), vertex(2, 1, 0), vertex(2, 1, 1), vertex(2, 0, 1), 3}};
+    }
+
+    GridData gridData;
+};
+
+FixtureTestSuite(GridFacesSuite, GridFacesFixture)
+
+TestCase(faces_of_two_hexahedra) {
+    GridFaces faces = buildGridFaces(this->gridData, 1);
+
+    checkEqual(faces.size(), 11);
+    checkEqual(faces.numberOfInternalFaces, 1);
+    checkEqual(faces.offsets.back(), 44);
+
+    checkEqual(faces.owners[0], 0);
+    checkEqual(faces.neighbours[0], 1);
+    checkEqual(faces.ownerFaces[0], 3);
+    checkEqual(faces.neighbourFaces[0], 5);
+    check(std::vector<GridIndex>(faces.vertices.cbegin(), faces.vertices.cbegin() + 4) == std::vector<GridIndex>({1, 4, 10, 7}));
+
+    checkEqual(faces.boundaryFacets.size(), 10u);
+    checkEqual(std::count(faces.neighbours.cbegin(), faces.neighbours.cend(), -1), 10);
+    checkEqual(std::count(faces.boundaryFacets.cbegin(), faces.boundaryFacets.cend(), -1), 8);
+    checkEqual(faces.owners[1], 0);
+    checkEqual(faces.boundaryFacets[0], 2);
+
+    auto east = std::find(faces.boundaryFacets.cbegin(), faces.boundaryFacets.cend(), 3) - faces.boundaryFacets.cbegin();
+    checkEqual(faces.owners[faces.numberOfInternalFaces + east], 1);
+    checkEqual(faces.ownerFaces[faces.numberOfInternalFaces + east], 3);
+}
+
+TestCase(faces_do_not_depend_on_the_number_of_threads) {
+    this->gridData.coordinates.push_back({1.0, 0.5, -1.0});
+    this->gridData.coordinates.push_back({1.0, 0.0, -1.0});
+    this->gridData.pyramidConnectivity = {{0, 3, 4, 1, 12, 4}};
+    this->gridData.tetrahedronConnectivity = {{1, 4, 12, 13, 5}};
+
+    GridFaces serial = buildGridFaces(this->gridData, 1);
+    GridFaces parallel = buildGridFaces(this->gridData, 4);
+
+    checkEqual(serial.size(), 11 + 4 + 3);
+    checkEqual(serial.numberOfInternalFaces, 3);
+    check(serial.vertices == parallel.vertices);
+    check(serial.owners == parallel.owners);
+    check(serial.neighbours == parallel.neighbours);
+    check(serial.neighbourFaces == parallel.neighbourFaces);
+    check(serial.boundaryFacets == parallel.boundaryFacets);
+
+    this->gridData.prismConnectivity = {{0, 1, 4, 3, 4, 1, 6}};
+    BOOST_CHECK_THROW(buildGridFaces(this->gridData, 2), std::runtime_error);
+}
+
+TestSuiteEnd()
@@ -0,0 +1,78 @@
+#include <BoostInterface/Test.hpp>
+#include <Grid/GridFaces.hpp>
+#include <Grid/GridGeometry.hpp>
+
+// A unit cube, a prism and a pyramid on top of it and a tetrahedron beside it, all sheared along x
+struct GridGeometryFixture {
+    GridGeometryFixture() {
+        this->gridData.dimension = 3;
+        this->gridData.coordinates = {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {1.0, 1.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}, {1.0, 0.0, 1.0}, {1.0, 1.0, 1.0}, {0.0, 1.0, 1.0}, {0.5, 0.5, 2.0}, {2.0, 0.0, 0.0}, {2.0, 0.0, 1.0}};
+        for (auto& coordinate : this->gridData.coordinates)
+            coordinate[0] += 0.25 * coordinate[2];
+
+        this->gridData.hexahedronConnectivity = {{0, 1, 2, 3, 4, 5, 6, 7, 1}};
+        this->gridData.pyramidConnectivity = {{4, 5, 6, 7, 8, 3}};
+        this->gridData.prismConnectivity = {{1, 9, 2, 5, 10, 6, 2}};
+        this->gridData.tetrahedronConnectivity = {{1, 9, 2, 5, 0}};
+        this->gridData.quadrangleConnectivity = {{0, 3, 2, 1, 4}};
+        this->gridData.triangleConnectivity = {{1, 9, 5, 5}};
+    }
+
+    GridData gridData;
+};
+
+FixtureTestSuite(GridGeometrySuite, GridGeometryFixture)
+
+TestCase(face_tables_drop_the_shape_padding) {
+    check(tetrahedronFaceTable() == FaceTable({{0, 2, 1}, {0, 1, 3}, {1, 2, 3}, {2, 0, 3}}));
+    check(prismFaceTable() == FaceTable({{0, 1, 4, 3}, {1, 2, 5, 4}, {2, 0, 3, 5}, {0, 2, 1}, {3, 4, 5}}));
+    check(pyramidFaceTable() == FaceTable({{0, 3, 2, 1}, {0, 1, 4}, {1, 2, 4}, {2, 3, 4}, {3, 0, 4}}));
+    checkEqual(hexahedronFaceTable().size(), 6u);
+    check(facetFaceTable(3) == FaceTable({{0, 1, 2}}));
+    check(facetFaceTable(4) == FaceTable({{0, 1, 2, 3}}));
+}
+
+TestCase(volumes_centroids_and_facets) {
+    GridGeometry geometry = computeGridGeometry(this->gridData, 2);
+
+    checkEqual(geometry.facetBegin, 4);
+    checkClose(geometry.volumes[0], 1.0 / 6.0, 1e-12);
+    checkClose(geometry.volumes[1], 1.0, 1e-12);
+    checkClose(geometry.volumes[2], 0.5, 1e-12);
+    checkClose(geometry.volumes[3], 1.0 / 3.0, 1e-12);
+
+    checkClose(geometry.centroids[0][1], 0.625, 1e-12);
+    checkClose(geometry.centroids[1][1], 0.5, 1e-12);
+    checkClose(geometry.centroids[2][1], 0.5, 1e-12);
+    checkClose(geometry.centroids[2][3], 1.25, 1e-12);
+    checkClose(geometry.centroids[0][2], (1.0 + 2.0 + 1.0) / 3.0 + 0.125, 1e-12);
+
+    checkClose(geometry.facetAreas[0], 1.0, 1e-12);
+    checkClose(geometry.facetNormals[2][0], -1.0, 1e-12);
+    checkClose(geometry.facetCentroids[0][0], 0.5, 1e-12);
+    checkClose(geometry.facetAreas[1], 0.5, 1e-12);
+    checkClose(geometry.facetNormals[1][1], -1.0, 1e-12);
+    checkClose(geometry.facetCentroids[0][1], (1.0 + 2.0 + 1.25) / 3.0, 1e-12);
+}
+
+TestCase(batches_do_not_depend_on_the_number_of_threads) {
+    for (int i = 1; i < 37; i++) {
+        auto hexahedron = this->gridData.hexahedronConnectivity[0];
+        hexahedron.back() = 3 + i;
+        this->gridData.hexahedronConnectivity.push_back(hexahedron);
+    }
+    this->gridData.quadrangleConnectivity[0].back() = 40;
+    this->gridData.triangleConnectivity[0].back() = 41;
+
+    GridGeometry serial = computeGridGeometry(this->gridData, 1);
+    GridGeometry parallel = computeGridGeometry(this->gridData, 3);
+    checkEqual(serial.volumes.size(), 40u);
+    check(serial.volumes == parallel.volumes);
+    check(serial.centroids == parallel.centroids);
+    checkClose(serial.volumes[39], 1.0, 1e-12);
+
+    this->gridData.triangleConnectivity[0].back() = 2;
+    BOOST_CHECK_THROW(computeGridGeometry(this->gridData, 2), std::runtime_error);
+}
+
+TestSuiteEnd()
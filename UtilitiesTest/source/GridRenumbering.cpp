@@ -0,0 +1,145 @@
+#include <BoostInterface/Test.hpp>
+#include <Grid/GridRenumbering.hpp>
+
+// A chain of hexahedra along x with the vertices and elements stored in a scrambled order
+struct GridRenumberingFixture {
+    GridRenumberingFixture() {
+        const int numberOfHexahedra = 8;
+        GridIndex numberOfVertices = 4 * (numberOfHexahedra + 1);
+        for (GridIndex vertex = 0; vertex < numberOfVertices; vertex++)
+            this->scrambled.push_back((vertex * 7 + 3) % numberOfVertices);
+
+        this->gridData.dimension = 3;
+        this->gridData.coordinates.resize(numberOfVertices);
+        auto vertex = [&](int i, int j, int k) {return this->scrambled[4 * i + 2 * k + j];};
+        for (int i = 0; i <= numberOfHexahedra; i++)
+            for (int k = 0; k < 2; k++)
+                for (int j = 0; j < 2; j++)
+                    this->gridData.coordinates[vertex(i, j, k)] = {double(i), double(j), double(k)};
+
+        for (int n = 0; n < numberOfHexahedra; n++) {
+            int i = (n * 3) % numberOfHexahedra;
+            this->gridData.hexahedronConnectivity.push_back({vertex(i, 0, 0), vertex(i + 1, 0, 0), vertex(i + 1, 1, 0), vertex(i, 1, 0), vertex(i, 0, 1), vertex(i + 1, 0, 1), vertex(i + 1, 1, 1), vertex(i, 1, 1), GridIndex(n)});
+        }
+        this->gridData.quadrangleConnectivity = {{vertex(0, 0, 0), vertex(0, 0, 1), vertex(0, 1, 1), vertex(0, 1, 0), 8}};
+        this->gridData.lineConnectivity = {{vertex(0, 0, 0), vertex(1, 0, 0), 9}};
+
+        this->gridData.regions = {RegionData{"Body", 0, 8}};
+        this->gridData.boundaries = {BoundaryData{"West", 8, 9, {vertex(0, 0, 0), vertex(0, 0, 1), vertex(0, 1, 1), vertex(0, 1, 0)}}};
+        std::sort(this->gridData.boundaries[0].vertices.begin(), this->gridData.boundaries[0].vertices.end());
+        this->gridData.wells = {WellData{"Well", 9, 10, {std::min(vertex(0, 0, 0), vertex(1, 0, 0)), std::max(vertex(0, 0, 0), vertex(1, 0, 0))}}};
+    }
+
+    GridIndex bandwidth() const {
+        GridIndex bandwidth = 0;
+        for (const auto& hexahedron : this->gridData.hexahedronConnectivity) {
+            auto extremes = std::minmax_element(hexahedron.cbegin(), hexahedron.cend() - 1);
+            bandwidth = std::max(bandwidth, *extremes.second - *extremes.first);
+        }
+        return bandwidth;
+    }
+
+    std::vector<GridIndex> scrambled;
+    GridData gridData;
+};
+
+FixtureTestSuite(GridRenumberingSuite, GridRenumberingFixture)
+
+TestCase(space_filling_curve_keys) {
+    checkEqual(spaceFillingCurveKey({1, 0, 0}, SpaceFillingCurve::morton, 1), 4u);
+    checkEqual(spaceFillingCurveKey({1, 1, 1}, SpaceFillingCurve::morton, 2), 7u);
+
+    std::vector<std::pair<std::uint64_t, std::array<int, 3>>> cells;
+    for (std::uint32_t i = 0; i < 4; i++)
+        for (std::uint32_t j = 0; j < 4; j++)
+            for (std::uint32_t k = 0; k < 4; k++)
+                cells.emplace_back(spaceFillingCurveKey({i, j, k}, SpaceFillingCurve::hilbert, 2), std::array<int, 3>{int(i), int(j), int(k)});
+    std::sort(cells.begin(), cells.end());
+
+    for (unsigned cell = 0; cell < cells.size(); cell++) {
+        checkEqual(cells[cell].first, cell);
+        if (cell > 0) {
+            int distance = 0;
+            for (int axis = 0; axis < 3; axis++)
+                distance += std::abs(cells[cell].second[axis] - cells[cell - 1].second[axis]);
+            checkEqual(distance, 1);
+        }
+    }
+}
+
+TestCase(reverse_cuthill_mckee_narrows_the_bandwidth) {
+    GridIndex scrambledBandwidth = this->bandwidth();
+    auto coordinates = this->gridData.coordinates;
+    auto hexahedra = this->gridData.hexahedronConnectivity;
+
+    for (int numberOfThreads : {1, 3})
+        check(reverseCuthillMcKee(this->gridData, numberOfThreads) == reverseCuthillMcKee(this->gridData, 1));
+    renumberVertices(this->gridData, reverseCuthillMcKee(this->gridData), 2);
+
+    check(this->bandwidth() < scrambledBandwidth);
+    checkEqual(this->bandwidth(), 7);
+    check(!this->gridData.vertexElementAdjacency);
+
+    for (unsigned h = 0; h < hexahedra.size(); h++)
+        for (int v = 0; v < 8; v++)
+            check(this->gridData.coordinates[this->gridData.hexahedronConnectivity[h][v]] == coordinates[hexahedra[h][v]]);
+
+    const auto& well = this->gridData.wells[0];
+    check(std::is_sorted(well.vertices.cbegin(), well.vertices.cend()));
+    checkEqual(this->gridData.coordinates[well.vertices[0]][0] + this->gridData.coordinates[well.vertices[1]][0], 1.0);
+    for (GridIndex vertex : this->gridData.boundaries[0].vertices)
+        checkEqual(this->gridData.coordinates[vertex][0], 0.0);
+
+    std::vector<GridIndex> repeated(this->gridData.coordinates.size(), 0);
+    BOOST_CHECK_THROW(renumberVertices(this->gridData, repeated), std::runtime_error);
+}
+
+TestCase(elements_follow_the_curve_inside_their_region) {
+    renumberElements(this->gridData, SpaceFillingCurve::morton, 2);
+
+    const auto& hexahedra = this->gridData.hexahedronConnectivity;
+    for (unsigned h = 0; h < hexahedra.size(); h++) {
+        checkEqual(hexahedra[h].back(), GridIndex(h));
+        checkEqual(this->gridData.coordinates[hexahedra[h][0]][0], double(h));
+    }
+    checkEqual(this->gridData.quadrangleConnectivity[0].back(), 8);
+    checkEqual(this->gridData.lineConnectivity[0].back(), 9);
+
+    renumberElements(this->gridData, SpaceFillingCurve::hilbert, 1);
+    std::vector<double> positions;
+    for (unsigned h = 0; h < hexahedra.size(); h++) {
+        checkEqual(hexahedra[h].back(), GridIndex(h));
+        positions.push_back(this->gridData.coordinates[hexahedra[h][0]][0]);
+    }
+    std::sort(positions.begin(), positions.end());
+    check(positions == std::vector<double>({0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0}));
+}
+
+TestCase(grouping_by_type_keeps_each_region_in_place) {
+    GridData mixed;
+    mixed.dimension = 3;
+    mixed.coordinates.resize(6);
+    mixed.tetrahedronConnectivity = {{0, 1, 2, 3, 1}, {1, 2, 3, 4, 3}, {2, 3, 4, 5, 5}};
+    mixed.pyramidConnectivity = {{0, 1, 2, 3, 4, 0}, {1, 2, 3, 4, 5, 2}};
+    mixed.prismConnectivity = {{0, 1, 2, 3, 4, 5, 4}};
+    mixed.triangleConnectivity = {{0, 1, 2, 6}};
+    mixed.regions = {RegionData{"Inner", 0, 4}, RegionData{"Outer", 4, 6}};
+    mixed.boundaries = {BoundaryData{"Face", 6, 7, {0, 1, 2}}};
+
+    groupElementsByType(mixed);
+
+    auto indices = [](const auto& connectivity) {
+        std::vector<GridIndex> indices;
+        for (const auto& element : connectivity)
+            indices.push_back(element.back());
+        return indices;
+    };
+    check(indices(mixed.tetrahedronConnectivity) == std::vector<GridIndex>({0, 1, 4}));
+    check(indices(mixed.pyramidConnectivity) == std::vector<GridIndex>({2, 3}));
+    check(indices(mixed.prismConnectivity) == std::vector<GridIndex>({5}));
+    checkEqual(mixed.tetrahedronConnectivity[1][0], 1);
+    checkEqual(mixed.pyramidConnectivity[0][4], 4);
+    checkEqual(mixed.triangleConnectivity[0].back(), 6);
+}
+
+TestSuiteEnd()
@@ -0,0 +1,114 @@
+#include <BoostInterface/Test.hpp>
+#include <Grid/GridSnapshot.hpp>
+
+struct GridSnapshotFixture {
+    GridSnapshotFixture() {
+        this->directory = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("GridSnapshot-%%%%%%%%")).string();
+        boost::filesystem::create_directories(this->directory);
+        this->sourcePath = this->directory + "/grid.msh";
+        std::ofstream(this->sourcePath) << "$MeshFormat\n2.2 0 8\n$EndMeshFormat\n";
+
+        this->gridData.dimension = 3;
+        this->gridData.coordinates = {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}, {1.0, 1.0, 1.0}};
+        this->gridData.tetrahedronConnectivity = {{0, 1, 2, 3, 0}};
+        this->gridData.pyramidConnectivity = {{0, 1, 4, 2, 3, 1}};
+        this->gridData.triangleConnectivity = {{0, 1, 2, 2}, {0, 2, 3, 3}};
+        this->gridData.lineConnectivity = {{0, 3, 4}};
+        this->gridData.regions = {RegionData{"Body", 0, 2}};
+        this->gridData.boundaries = {BoundaryData{"Bottom", 2, 3, {0, 1, 2}}, BoundaryData{"West", 3, 4, {0, 2, 3}}};
+        this->gridData.wells = {WellData{"Well", 4, 5, {0, 3}}};
+    }
+
+    ~GridSnapshotFixture() {
+        boost::filesystem::remove_all(this->directory);
+    }
+
+    std::string directory, sourcePath;
+    GridData gridData;
+};
+
+FixtureTestSuite(GridSnapshotSuite, GridSnapshotFixture)
+
+TestCase(snapshot_round_trip) {
+    std::string snapshotPath = this->directory + "/grid.snapshot";
+    writeGridSnapshot(this->gridData, 42, snapshotPath);
+    auto snapshot = readGridSnapshot(snapshotPath, 42);
+
+    checkEqual(snapshot->dimension, 3);
+    check(snapshot->coordinates == this->gridData.coordinates);
+    check(snapshot->tetrahedronConnectivity == this->gridData.tetrahedronConnectivity);
+    check(snapshot->pyramidConnectivity == this->gridData.pyramidConnectivity);
+    check(snapshot->triangleConnectivity == this->gridData.triangleConnectivity);
+    check(snapshot->lineConnectivity == this->gridData.lineConnectivity);
+    checkEqual(snapshot->hexahedronConnectivity.size(), 0u);
+
+    checkEqual(snapshot->regions.size(), 1u);
+    checkEqual(snapshot->regions[0].name, "Body");
+    checkEqual(snapshot->regions[0].elementEnd, 2);
+    checkEqual(snapshot->boundaries.size(), 2u);
+    checkEqual(snapshot->boundaries[1].name, "West");
+    checkEqual(snapshot->boundaries[1].facetBegin, 3);
+    check(snapshot->boundaries[1].vertices == this->gridData.boundaries[1].vertices);
+    checkEqual(snapshot->wells[0].name, "Well");
+    check(snapshot->wells[0].vertices == this->gridData.wells[0].vertices);
+
+    BOOST_CHECK_THROW(readGridSnapshot(snapshotPath, 43), std::runtime_error);
+    BOOST_CHECK_THROW(readGridSnapshot(this->sourcePath, 42), std::runtime_error);
+}
+
+TestCase(snapshot_of_another_reader_version_is_rejected) {
+    std::string snapshotPath = this->directory + "/grid.snapshot";
+    writeGridSnapshot(this->gridData, 42, snapshotPath);
+
+    std::uint32_t readerVersion = gridReaderVersion + 1;
+    std::fstream file(snapshotPath, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(offsetof(GridSnapshotHeader, readerVersion));
+    file.write(reinterpret_cast<const char*>(&readerVersion), sizeof(readerVersion));
+    file.close();
+
+    BOOST_CHECK_THROW(readGridSnapshot(snapshotPath, 42), std::runtime_error);
+}
+
+TestCase(file_hash_follows_content) {
+    std::uint64_t hash = hashFile(this->sourcePath);
+    checkEqual(hashFile(this->sourcePath, 1), hash);
+
+    std::ofstream(this->sourcePath, std::ios::app) << "$PhysicalNames\n0\n$EndPhysicalNames\n";
+    check(hashFile(this->sourcePath) != hash);
+}
+
+TestCase(read_through_snapshot_reads_the_source_once) {
+    int numberOfReads = 0;
+    auto read = [&]() {
+        numberOfReads++;
+        return boost::make_shared<GridData>(this->gridData);
+    };
+
+    auto first = readThroughSnapshot(this->sourcePath, "Reader", this->directory + "/cache", read);
+    auto second = readThroughSnapshot(this->sourcePath, "Reader", this->directory + "/cache", read);
+    checkEqual(numberOfReads, 1);
+    check(second->prismConnectivity == first->prismConnectivity);
+    check(second->boundaries[0].vertices == first->boundaries[0].vertices);
+
+    readThroughSnapshot(this->sourcePath, "OtherReader", this->directory + "/cache", read);
+    checkEqual(numberOfReads, 2);
+
+    std::ofstream(this->sourcePath, std::ios::app) << "\n";
+    readThroughSnapshot(this->sourcePath, "Reader", this->directory + "/cache", read);
+    checkEqual(numberOfReads, 3);
+}
+
+TestCase(read_through_snapshot_returns_the_grid_when_the_snapshot_cannot_be_written) {
+    std::string blockedPath = this->directory + "/blocked";
+    std::ofstream(blockedPath) << "not a directory";
+
+    int numberOfReads = 0;
+    auto gridData = readThroughSnapshot(this->sourcePath, "Reader", blockedPath + "/cache", [&]() {
+        numberOfReads++;
+        return boost::make_shared<GridData>(this->gridData);
+    });
+    checkEqual(numberOfReads, 1);
+    check(gridData->coordinates == this->gridData.coordinates);
+}
+
+TestSuiteEnd()
@@ -0,0 +1,75 @@
+#include <BoostInterface/Test.hpp>
+#include <Utilities/Parallel.hpp>
+#include <Utilities/BoundedQueue.hpp>
+
+TestCase(parallel_for_visits_every_task_once) {
+    std::vector<int> visits(1000, 0);
+    parallelFor(visits.size(), 4, [&](int task) {visits[task]++;});
+
+    check(std::all_of(visits.cbegin(), visits.cend(), [](auto v){return v == 1;}));
+}
+
+TestCase(parallel_for_rethrows_task_exception) {
+    BOOST_CHECK_THROW(parallelFor(100, 4, [](int task) {if (task == 42) throw std::runtime_error("task");}), std::runtime_error);
+}
+
+TestCase(split_lines_on_line_starts) {
+    std::string text("1 0 0\n2 1 0\n3 1 1\n4 0 1\n");
+    auto bounds = splitLines(text.data(), text.data() + text.size(), 3);
+
+    checkEqual(bounds.size(), 4u);
+    check(bounds.front() == text.data());
+    check(bounds.back() == text.data() + text.size());
+    for (unsigned i = 1; i < bounds.size() - 1; i++)
+        checkEqual(*(bounds[i] - 1), '\n');
+}
+
+TestCase(for_each_line_assigns_global_indices) {
+    std::string text("10\n\n11\n12\r\n13\n14\n15\n16\n");
+    std::vector<int> values(7, 0);
+    forEachLine(text.data(), text.data() + text.size(), 7, 3, [&](int index, const char* position, const char* lineEnd) {
+        values[index] = parse<int>(position, lineEnd);
+    });
+
+    for (int i = 0; i < 7; i++)
+        checkEqual(values[i], 10 + i);
+
+    BOOST_CHECK_THROW(forEachLine(text.data(), text.data() + text.size(), 8, 3, [](int, const char*, const char*) {}), std::runtime_error);
+}
+
+TestCase(counting_sort_is_stable) {
+    std::vector<int> keys{2, 0, 1, 2, 0, 0, 3, 1, 2, 0};
+    std::vector<int> offsets;
+    std::vector<int> sorted = countingSort(0, keys.size(), 5, 3, [&](int index) {return keys[index];}, offsets);
+
+    std::vector<int> expected(keys.size());
+    std::iota(expected.begin(), expected.end(), 0);
+    std::stable_sort(expected.begin(), expected.end(), [&](int a, int b) {return keys[a] < keys[b];});
+
+    check(sorted == expected);
+    check(offsets == std::vector<int>({0, 4, 6, 9, 10, 10}));
+}
+
+TestCase(counting_sort_rejects_out_of_range_keys) {
+    std::vector<int> offsets;
+    BOOST_CHECK_THROW(countingSort(0, 10, 2, 2, [](int index) {return index;}, offsets), std::runtime_error);
+}
+
+TestCase(bounded_queue_passes_values_between_threads) {
+    BoundedQueue<int> queue(2);
+    std::thread producer([&queue]() {
+        for (int i = 0; i < 100; i++)
+            queue.push(i);
+        queue.close();
+    });
+
+    std::vector<int> values;
+    int value;
+    while (queue.pop(value))
+        values.push_back(value);
+    producer.join();
+
+    checkEqual(values.size(), 100u);
+    for (int i = 0; i < 100; i++)
+        checkEqual(values[i], i);
+}
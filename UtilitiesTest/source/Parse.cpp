@@ -0,0 +1,49 @@
+#include <BoostInterface/Test.hpp>
+#include <Utilities/Parse.hpp>
+
+#define TOLERANCE 1e-12
+
+TestCase(parse_values_from_character_range) {
+    std::string text("14\r\n1 0.5 -1.25e+01 3\n\"West side\" 7");
+    const char* position = text.data();
+    const char* end = text.data() + text.size();
+
+    checkEqual(parse<int>(position, end), 14);
+    checkEqual(parse<int>(position, end), 1);
+    checkClose(parse<double>(position, end), 0.5, TOLERANCE);
+    checkClose(parse<double>(position, end), -12.5, TOLERANCE);
+    checkEqual(parse<long>(position, end), 3l);
+    check(parseQuoted(position, end) == std::string("West side"));
+    checkEqual(parse<int>(position, end), 7);
+    check(skipBlanks(position, end) == end);
+}
+
+TestCase(skip_lines_in_character_range) {
+    std::string text("$Nodes\n2\n$EndNodes");
+    const char* position = text.data();
+    const char* end = text.data() + text.size();
+
+    position = skipLine(position, end);
+    checkEqual(*position, '2');
+    position = skipLine(position, end);
+    checkEqual(*position, '$');
+    check(skipLine(position, end) == end);
+}
+
+TestCase(parse_invalid_value) {
+    std::string text("node");
+    const char* position = text.data();
+
+    BOOST_CHECK_THROW(parse<int>(position, text.data() + text.size()), std::runtime_error);
+}
+
+TestCase(parse_binary_values) {
+    std::string text("\x01\x00\x00\x00\x00\x00\x00\x02", 8);
+    const char* position = text.data();
+    const char* end = text.data() + text.size();
+
+    checkEqual(parseBinary<int>(position, end, false), 1);
+    checkEqual(parseBinary<int>(position, end, true), 2);
+    check(position == end);
+    BOOST_CHECK_THROW(parseBinary<int>(position, end, false), std::runtime_error);
+}
@@ -0,0 +1,80 @@
+#include <BoostInterface/Test.hpp>
+#include <Grid/PipelinedGridStream.hpp>
+
+// Hands out one vertex and one element per chunk, and fails at the given connectivity chunk
+class CountingGridStream : public GridStream {
+    public:
+        CountingGridStream(int numberOfChunks, int failingChunk = -1) : numberOfChunks(numberOfChunks), failingChunk(failingChunk) {}
+
+        boost::shared_ptr<GridData> getGridData() const override {
+            return boost::make_shared<GridData>();
+        }
+
+        GridIndex getNumberOfVertices() const override {
+            return this->numberOfChunks;
+        }
+
+        int getSectionElementSize(int) const override {
+            return 2;
+        }
+
+        void streamCoordinates(const std::function<void(const CoordinateChunk&)>& write) override {
+            for (int chunk = 0; chunk < this->numberOfChunks; chunk++)
+                write(CoordinateChunk{chunk, {{double(chunk), 0.0, 0.0}}});
+        }
+
+        void streamConnectivities(const std::function<void(const ConnectivityChunk&)>& write) override {
+            for (int chunk = 0; chunk < this->numberOfChunks; chunk++) {
+                if (chunk == this->failingChunk)
+                    throw std::runtime_error("Broken chunk");
+                write(ConnectivityChunk{0, chunk, {2}, {chunk, chunk + 1}});
+            }
+        }
+
+    private:
+        int numberOfChunks, failingChunk;
+};
+
+TestSuite(PipelinedGridStreamSuite)
+
+TestCase(pipelined_stream_hands_out_every_chunk_in_order) {
+    PipelinedGridStream stream(boost::make_shared<CountingGridStream>(50), 2);
+    checkEqual(stream.getNumberOfVertices(), 50);
+    checkEqual(stream.getSectionElementSize(0), 2);
+
+    std::vector<double> coordinates;
+    stream.streamCoordinates([&](const CoordinateChunk& chunk) {
+        checkEqual(chunk.begin, GridIndex(coordinates.size()));
+        coordinates.push_back(chunk.coordinates[0][0]);
+    });
+    checkEqual(coordinates.size(), 50u);
+    checkEqual(coordinates.back(), 49.0);
+
+    std::vector<GridIndex> begins;
+    stream.streamConnectivities([&](const ConnectivityChunk& chunk) {
+        check(chunk.vertices == std::vector<GridIndex>({chunk.begin, chunk.begin + 1}));
+        begins.push_back(chunk.begin);
+    });
+    checkEqual(begins.size(), 50u);
+    for (GridIndex i = 0; i < 50; i++)
+        checkEqual(begins[i], i);
+}
+
+TestCase(pipelined_stream_passes_on_the_parsing_errors) {
+    PipelinedGridStream stream(boost::make_shared<CountingGridStream>(50, 30), 2);
+    stream.streamCoordinates([](const CoordinateChunk&) {});
+
+    int numberOfChunks = 0;
+    BOOST_CHECK_THROW(stream.streamConnectivities([&](const ConnectivityChunk&) {numberOfChunks++;}), std::runtime_error);
+    checkEqual(numberOfChunks, 30);
+}
+
+TestCase(pipelined_stream_stops_parsing_when_the_writer_fails) {
+    PipelinedGridStream stream(boost::make_shared<CountingGridStream>(1000), 2);
+    BOOST_CHECK_THROW(stream.streamCoordinates([](const CoordinateChunk& chunk) {
+        if (chunk.begin == 10)
+            throw std::runtime_error("Broken writer");
+    }), std::runtime_error);
+}
+
+TestSuiteEnd()
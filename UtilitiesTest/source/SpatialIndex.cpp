@@ -0,0 +1,74 @@
+#include <BoostInterface/Test.hpp>
+#include <functional>
+#include <Grid/SpatialIndex.hpp>
+
+struct SpatialIndexFixture {
+    SpatialIndexFixture() {
+        this->gridData.dimension = 3;
+        for (int k = 0; k < 4; k++)
+            for (int j = 0; j < 5; j++)
+                for (int i = 0; i < 6; i++)
+                    this->gridData.coordinates.push_back({0.5 * i + 0.01 * j, 0.3 * j, 0.7 * k - 0.02 * i});
+    }
+
+    std::vector<GridIndex> bruteForce(std::function<bool(const std::array<double, 3>&)> isInside) const {
+        std::vector<GridIndex> found;
+        for (GridIndex vertex = 0; vertex < GridIndex(this->gridData.coordinates.size()); vertex++)
+            if (isInside(this->gridData.coordinates[vertex]))
+                found.push_back(vertex);
+        return found;
+    }
+
+    GridData gridData;
+};
+
+FixtureTestSuite(SpatialIndexSuite, SpatialIndexFixture)
+
+TestCase(spatial_index_queries_match_a_linear_scan) {
+    std::array<double, 3> point{1.1, 0.65, 1.0};
+
+    for (int numberOfThreads : {1, 3}) {
+        auto index = buildSpatialIndex(this->gridData.coordinates, numberOfThreads);
+        checkEqual(index->size(), this->gridData.coordinates.size());
+
+        check(index->findWithinRadius(point, 0.6) == this->bruteForce([&](const auto& c) {return SpatialIndex::squaredDistance(c, point) <= 0.36;}));
+        check(index->findInBox({0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}) == this->bruteForce([](const auto& c) {return c[0] >= 0.0 && c[0] <= 1.0 && c[1] >= 0.0 && c[1] <= 1.0 && c[2] >= 0.0 && c[2] <= 1.0;}));
+        check(index->findOnLine({1.0, 0.6, 0.0}, 2, 0.05) == this->bruteForce([](const auto& c) {return std::abs(c[0] - 1.0) <= 0.05 && std::abs(c[1] - 0.6) <= 0.05;}));
+
+        for (std::array<double, 3> probe : {point, std::array<double, 3>{-5.0, 10.0, 0.3}, std::array<double, 3>{2.5, 0.0, 2.0}}) {
+            auto nearest = this->bruteForce([](const auto&) {return true;});
+            auto closest = *std::min_element(nearest.cbegin(), nearest.cend(), [&](GridIndex a, GridIndex b) {
+                return SpatialIndex::squaredDistance(this->gridData.coordinates[a], probe) < SpatialIndex::squaredDistance(this->gridData.coordinates[b], probe);
+            });
+            checkEqual(index->findNearest(probe), closest);
+        }
+    }
+}
+
+TestCase(spatial_index_handles_flat_and_empty_grids) {
+    std::vector<std::array<double, 3>> coordinates{{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {1.0, 1.0, 0.0}};
+    auto flat = buildSpatialIndex(coordinates, 2);
+    checkEqual(flat->numberOfCells[2], 1);
+    checkEqual(flat->findNearest({0.9, 0.8, 3.0}), 3);
+    check(flat->findOnLine({0.0, 0.0, 0.0}, 1, 1e-8) == std::vector<GridIndex>({0, 2}));
+
+    auto empty = buildSpatialIndex({}, 2);
+    checkEqual(empty->findNearest({0.0, 0.0, 0.0}), -1);
+    check(empty->findWithinRadius({0.0, 0.0, 0.0}, 1.0).empty());
+}
+
+TestCase(spatial_index_is_cached_until_the_vertices_change) {
+    const SpatialIndex* first = &getSpatialIndex(this->gridData);
+    checkEqual(&getSpatialIndex(this->gridData), first);
+
+    this->gridData.coordinates.push_back({10.0, 10.0, 10.0});
+    checkEqual(getSpatialIndex(this->gridData).findNearest({9.0, 9.0, 9.0}), 120);
+
+    for (auto& coordinate : this->gridData.coordinates)
+        for (auto& value : coordinate)
+            value *= 2.0;
+    checkEqual(getSpatialIndex(this->gridData).findNearest({19.0, 19.0, 19.0}), 120);
+    check(getSpatialIndex(this->gridData).findWithinRadius({10.0, 10.0, 10.0}, 0.5).empty());
+}
+
+TestSuiteEnd()
@@ -0,0 +1,43 @@
+#include <BoostInterface/Test.hpp>
+#include <Grid/VertexElementAdjacency.hpp>
+
+TestCase(vertex_element_adjacency_lists_the_elements_of_every_vertex) {
+    GridData gridData;
+    gridData.dimension = 3;
+    gridData.coordinates.resize(8);
+    gridData.tetrahedronConnectivity = {{0, 1, 2, 3, 0}};
+    gridData.prismConnectivity = {{1, 2, 3, 4, 5, 6, 1}, {2, 3, 4, 5, 6, 7, 2}};
+    gridData.pyramidConnectivity = {{0, 4, 5, 6, 7, 3}};
+    gridData.triangleConnectivity = {{0, 1, 2, 4}};
+
+    for (int numberOfThreads : {1, 3}) {
+        auto adjacency = buildVertexElementAdjacency(gridData, numberOfThreads);
+
+        checkEqual(adjacency->hexahedronBegin, 1);
+        checkEqual(adjacency->prismBegin, 1);
+        checkEqual(adjacency->pyramidBegin, 3);
+        checkEqual(adjacency->numberOfElements, 4);
+        check(adjacency->offsets == std::vector<GridIndex>({0, 2, 4, 7, 10, 13, 16, 19, 21}));
+        check(std::vector<GridIndex>(adjacency->begin(3), adjacency->end(3)) == std::vector<GridIndex>({0, 1, 2}));
+        check(std::vector<GridIndex>(adjacency->begin(4), adjacency->end(4)) == std::vector<GridIndex>({1, 2, 3}));
+        check(std::vector<GridIndex>(adjacency->begin(7), adjacency->end(7)) == std::vector<GridIndex>({2, 3}));
+    }
+}
+
+TestCase(vertex_element_adjacency_is_cached_until_the_elements_change) {
+    GridData gridData;
+    gridData.dimension = 3;
+    gridData.coordinates.resize(5);
+    gridData.tetrahedronConnectivity = {{0, 1, 2, 3, 0}};
+
+    const VertexElementAdjacency* first = &getVertexElementAdjacency(gridData);
+    checkEqual(&getVertexElementAdjacency(gridData), first);
+    checkEqual(first->end(4) - first->begin(4), 0);
+
+    gridData.tetrahedronConnectivity.push_back({1, 2, 3, 4, 1});
+    const VertexElementAdjacency& second = getVertexElementAdjacency(gridData);
+    check(std::vector<GridIndex>(second.begin(4), second.end(4)) == std::vector<GridIndex>({1}));
+
+    gridData.coordinates.resize(4);
+    BOOST_CHECK_THROW(getVertexElementAdjacency(gridData), std::runtime_error);
+}
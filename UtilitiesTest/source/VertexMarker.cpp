@@ -0,0 +1,26 @@
+#include <BoostInterface/Test.hpp>
+#include <Grid/VertexMarker.hpp>
+
+TestCase(vertex_marker_extracts_sorted_unique_vertices) {
+    std::vector<std::array<GridIndex, 3>> lines{{4, 2, 0}, {2, 5, 1}, {5, 1, 2}, {1, 3, 3}};
+    VertexMarker marker(6);
+
+    marker.mark(lines, 1, 3);
+    check(marker.extract() == std::vector<GridIndex>({1, 2, 5}));
+
+    marker.mark(lines, 0, 1);
+    marker.mark(lines, 3, 4);
+    check(marker.extract() == std::vector<GridIndex>({1, 2, 3, 4}));
+}
+
+TestCase(mark_vertices_of_every_group) {
+    std::vector<std::array<GridIndex, 3>> lines{{0, 1, 0}, {1, 2, 1}, {3, 4, 2}, {4, 0, 3}};
+    std::vector<std::vector<GridIndex>> vertices(2);
+    markVertices(2, 5, 2, [&](int group, VertexMarker& marker) {
+        marker.mark(lines, 2 * group, 2 * group + 2);
+        vertices[group] = marker.extract();
+    });
+
+    check(vertices[0] == std::vector<GridIndex>({0, 1, 2}));
+    check(vertices[1] == std::vector<GridIndex>({0, 3, 4}));
+}
@@ -0,0 +1,37 @@
+
+# Find the native ZSTD includes and library
+#
+# ZSTD_INCLUDE_DIR - where to find zstd.h, etc.
+# ZSTD_LIBRARIES   - List of fully qualified libraries to link against when using ZSTD.
+# ZSTD_FOUND       - Do not attempt to use ZSTD if "no" or undefined.
+
+find_path(ZSTD_INCLUDE_DIR zstd.h
+  HINTS ${ZSTD_DIR}/include
+)
+
+find_library(ZSTD_LIBRARY zstd
+  HINTS ${ZSTD_DIR}/lib
+)
+
+set(ZSTD_FOUND "NO")
+if (ZSTD_INCLUDE_DIR)
+  if (ZSTD_LIBRARY)
+    set(ZSTD_LIBRARIES ${ZSTD_LIBRARY})
+    set(ZSTD_FOUND "YES")
+  endif ()
+endif ()
+
+if (ZSTD_FIND_REQUIRED AND NOT ZSTD_FOUND)
+  message(SEND_ERROR "Unable to find the requested ZSTD libraries.")
+endif ()
+
+# handle the QUIETLY and REQUIRED arguments and set ZSTD_FOUND to TRUE if
+# all listed variables are TRUE
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(ZSTD DEFAULT_MSG ZSTD_LIBRARY ZSTD_INCLUDE_DIR)
+
+
+mark_as_advanced(
+  ZSTD_INCLUDE_DIR
+  ZSTD_LIBRARY
+)
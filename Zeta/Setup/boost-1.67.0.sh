@@ -18,6 +18,6 @@ fi
 
 cd $LIBRARY
 
-./bootstrap.sh --with-libraries=system,filesystem,test --prefix=$LIBRARY_INSTALL_DIRECTORY/$LIBRARY/$BUILD_TYPE
+./bootstrap.sh --with-libraries=system,filesystem,iostreams,test --prefix=$LIBRARY_INSTALL_DIRECTORY/$LIBRARY/$BUILD_TYPE
 
 ./b2 variant=$VARIANT --cxxflags=-fPIC link=shared runtime-link=shared threading=multi -j 2 --prefix=$LIBRARY_INSTALL_DIRECTORY/$LIBRARY/$BUILD_TYPE install
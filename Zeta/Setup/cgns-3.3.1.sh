@@ -18,7 +18,17 @@ if [ "${BUILD_TYPE^^}" == "RELEASE" ]; then
     CGNS_CONFIGURE_FLAG="--disable-debug"
 fi
 
-./configure --without-fortran --disable-cgnstools --enable-shared $CGNS_CONFIGURE_FLAG --prefix=$LIBRARY_INSTALL_DIRECTORY/$LIBRARY/$BUILD_TYPE
+if [ "${GRID_64_BIT_INDICES^^}" == "ON" ]; then
+    CGNS_CONFIGURE_FLAG="$CGNS_CONFIGURE_FLAG --enable-64bit"
+fi
+
+if [ -n "$HDF5_DIRECTORY" ]; then
+    CGNS_CONFIGURE_FLAG="$CGNS_CONFIGURE_FLAG --with-hdf5=$HDF5_DIRECTORY"
+else
+    CGNS_CONFIGURE_FLAG="$CGNS_CONFIGURE_FLAG --with-hdf5"
+fi
+
+./configure --without-fortran --disable-cgnstools --enable-shared --with-zlib $CGNS_CONFIGURE_FLAG --prefix=$LIBRARY_INSTALL_DIRECTORY/$LIBRARY/$BUILD_TYPE
 
 make -j 2
 
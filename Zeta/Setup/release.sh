@@ -21,7 +21,7 @@ cd $SETUP_DIRECTORY
     mv CGNS $LIBRARY
     cd $LIBRARY
     cd src
-    ./../src/configure --without-fortran --disable-cgnstools --enable-shared \
+    ./../src/configure --without-fortran --disable-cgnstools --enable-shared --with-zlib --with-hdf5${HDF5_DIRECTORY:+=$HDF5_DIRECTORY} \
                        --disable-debug --prefix=$LIBRARY_INSTALL_DIRECTORY/$LIBRARY/$BUILD_TYPE
     make -j 4
     make install
@@ -0,0 +1,6 @@
+#ifndef IOSTREAMS_HPP
+#define IOSTREAMS_HPP
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#endif
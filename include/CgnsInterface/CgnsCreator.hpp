@@ -6,6 +6,29 @@
 #include <BoostInterface/Filesystem.hpp>
 #include <Utilities/Vector.hpp>
 #include <Grid/GridData.hpp>
+#include <Grid/GridDataSoA.hpp>
+#include <Grid/GridDataView.hpp>
+
+// The connectivity of one section as it is written, with 1-based vertices and the element type ahead of every element of a MIXED section.
+// Sections holding one element type of a region carry the region name as family.
+struct PackedSection {
+    std::string name;
+    std::string family;
+    int dimension;
+    int elementType;
+    GridIndex elementBegin;
+    GridIndex elementEnd;
+    std::vector<GridIndex> connectivities;
+};
+
+// The storage the CGNS library picks for new files, library keeping its own default or the CGNS_FILETYPE environment variable
+enum class CgnsBackend {library, hdf5, adf};
+
+// A compressionLevel from 1 to 9 deflates the HDF5 datasets, trading write and read time for file size. ADF files can not be compressed.
+struct CgnsFileOptions {
+    CgnsBackend backend = CgnsBackend::library;
+    int compressionLevel = 0;
+};
 
 class CgnsCreator {
     public:
@@ -19,24 +42,32 @@ class CgnsCreator {
         virtual void checkDimension() = 0;
         virtual void setDimensions() = 0;
         void setupFile();
+        void configureFile();
         virtual void initialize();
         void writeBase();
         void writeZone();
         virtual void writeCoordinates() = 0;
-        virtual void buildGlobalConnectivities() = 0;
+        void writeCoordinateChunks(const GridDataView& view);
+        void writeCoordinateArrays(const GridDataSoA& coordinates, GridIndex begin);
+        virtual void buildSections() = 0;
+        void packSections(const GridDataView& view);
+        void stageElements(const PackedSection& section, GridIndex begin, GridIndex end, std::vector<GridIndex>& staging) const;
         virtual void writeSections();
-        virtual void writeRegions() = 0;
-        virtual void writeBoundaries() = 0;
         void writeBoundaryConditions();
 
         boost::shared_ptr<GridData> gridData;
         std::string folderPath, baseName, zoneName, fileName;
         int fileIndex, baseIndex, zoneIndex, cellDimension, physicalDimension;
-        int sizes[3];
+        GridIndex sizes[3];
         int coordinateIndex, sectionIndex, boundaryIndex;
-        int elementStart, elementEnd;
+        GridIndex elementStart, elementEnd;
+        bool homogeneousSections;
+        GridIndex chunkSize;
+        CgnsFileOptions fileOptions;
 
-        std::vector<std::vector<int>> globalConnectivities;
+        std::vector<PackedSection> packedSections;
+        std::vector<unsigned char> elementSizes;
+        const GridDataView* sectionView;
 };
 
 #endif
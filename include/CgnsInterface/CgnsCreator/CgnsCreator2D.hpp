@@ -5,15 +5,16 @@
 
 class CgnsCreator2D : public CgnsCreator {
     public:
-        CgnsCreator2D(boost::shared_ptr<GridData> gridData, std::string folderPath);
+        // A positive chunkSize bounds the vertices and elements staged for each partial write
+        CgnsCreator2D(boost::shared_ptr<GridData> gridData, std::string folderPath, GridIndex chunkSize = 0, CgnsFileOptions fileOptions = CgnsFileOptions());
 
     private:
         void checkDimension() override;
         void setDimensions() override;
         void writeCoordinates() override;
-        void buildGlobalConnectivities() override;
-        void writeRegions() override;
-        void writeBoundaries() override;
+        void buildSections() override;
+
+        GridDataView view;
 };
 
 #endif
@@ -2,20 +2,26 @@
 #define CGNS_CREATOR_3D_HPP
 
 #include <CgnsInterface/CgnsCreator.hpp>
+#include <Grid/GridDataView.hpp>
+#include <Grid/GridFaces.hpp>
 
 class CgnsCreator3D : public CgnsCreator {
     public:
-        CgnsCreator3D(boost::shared_ptr<GridData> gridData, std::string folderPath);
+        // With homogeneousSections every region mixing element types is written as one section per type, all tagged with the region as family.
+        // A positive chunkSize bounds the vertices and elements staged for each partial write.
+        CgnsCreator3D(boost::shared_ptr<GridData> gridData, std::string folderPath, bool homogeneousSections = false, GridIndex chunkSize = 0, CgnsFileOptions fileOptions = CgnsFileOptions());
+
+        CgnsCreator3D(GridDataView view, std::string folderPath, bool homogeneousSections = false, GridIndex chunkSize = 0, CgnsFileOptions fileOptions = CgnsFileOptions());
+
+        void writeFaces(const GridFaces& gridFaces);
 
     private:
         void checkDimension() override;
         void setDimensions() override;
         void writeCoordinates() override;
-        void buildGlobalConnectivities() override;
-        void writeSections() override;
-        void writeRegions() override;
-        void writeBoundaries() override;
-        void writeWells();
+        void buildSections() override;
+
+        GridDataView view;
 };
 
 #endif
@@ -0,0 +1,26 @@
+#ifndef CGNS_STREAM_CREATOR_HPP
+#define CGNS_STREAM_CREATOR_HPP
+
+#include <CgnsInterface/CgnsCreator.hpp>
+#include <Grid/GridStream.hpp>
+
+class CgnsStreamCreator : public CgnsCreator {
+    public:
+        CgnsStreamCreator(boost::shared_ptr<GridStream> gridStream, std::string folderPath, CgnsFileOptions fileOptions = CgnsFileOptions());
+
+    private:
+        void checkDimension() override;
+        void setDimensions() override;
+        void writeCoordinates() override;
+        void buildSections() override;
+        void writeSections() override;
+        void writeRegions();
+        void writeBoundaries();
+        void writeSection(const std::string& name, int section, GridIndex begin, GridIndex end);
+        int findElementType(int section, int numberOfVertices) const;
+
+        boost::shared_ptr<GridStream> gridStream;
+        std::vector<int> sectionIndices, sectionTypes;
+};
+
+#endif
@@ -28,15 +28,16 @@ class CgnsReader {
         void createGridData();
         virtual void readCoordinates() = 0;
         virtual void readSections() = 0;
-        void addRegion(std::string&& name, int elementStart, int elementEnd);
-        void addBoundary(std::string&& name, int elementStart, int elementEnd);
+        std::string readRegionName(int sectionIndex);
+        void addRegion(std::string&& name, GridIndex elementStart, GridIndex elementEnd);
+        void addBoundary(std::string&& name, GridIndex elementStart, GridIndex elementEnd);
         void readBoundaryConditions();
         int readSolutionIndex(std::string solutionName);
 
         std::string filePath;
         char buffer[800];
         int fileIndex, baseIndex, zoneIndex, cellDimension, physicalDimension;
-        int sizes[3];
+        GridIndex sizes[3];
         int numberOfSections, numberOfBoundaries;
 };
 
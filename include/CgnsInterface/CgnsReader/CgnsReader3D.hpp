@@ -2,6 +2,7 @@
 #define CGNS_READER_3D_HPP
 
 #include <CgnsInterface/CgnsReader.hpp>
+#include <Grid/VertexMarker.hpp>
 
 class CgnsReader3D : public CgnsReader {
     public:
@@ -10,7 +11,7 @@ class CgnsReader3D : public CgnsReader {
     protected:
         void readCoordinates() override;
         void readSections() override;
-        void addWell(std::string&& name, int elementStart, int elementEnd);
+        void addWell(std::string&& name, GridIndex elementStart, GridIndex elementEnd);
         void findWellVertices();
 };
 
@@ -9,6 +9,7 @@
 #include <BoostInterface/Filesystem.hpp>
 #include <BoostInterface/PropertyTree.hpp>
 #include <Grid/GridData.hpp>
+#include <Grid/GridDataView.hpp>
 
 struct GridDataExtractorData {
     std::vector<std::string> regions;
@@ -40,9 +41,14 @@ class GridDataExtractor {
         boost::property_tree::ptree propertyTree;
 
         std::vector<GridDataExtractorData> gridDataExtractorDatum;
-        std::vector<std::vector<int>> elementConnectivities;
-        std::set<int> vertices;
-        int localIndex = 0;
+        std::vector<std::vector<GridIndex>> elementConnectivities;
+        std::set<GridIndex> vertices;
+        GridIndex localIndex = 0;
 };
 
+// Selects the same entities as the extractor script, referencing the original instead of copying it and leaving its boundaries in place
+GridDataView extractView(boost::shared_ptr<GridData> original, boost::property_tree::ptree propertyTree);
+
+GridDataView extractView(boost::shared_ptr<GridData> original, std::string gridDataExtractorScript);
+
 #endif
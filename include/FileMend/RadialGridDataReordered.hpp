@@ -9,6 +9,7 @@
 #include <BoostInterface/Filesystem.hpp>
 #include <Utilities/Algorithm.hpp>
 #include <Grid/GridData.hpp>
+#include <Grid/VertexElementAdjacency.hpp>
 
 class RadialGridDataReordered {
     public:
@@ -27,12 +28,12 @@ class RadialGridDataReordered {
         void reorderBoundaries();
         void copyData();
         void reorder();
-        void buildFirstSection();
-        void addVertex(int vertex, int section);
-        void updateTriangle(std::vector<std::array<int, 7>>::iterator prism, std::vector<std::array<int, 4>>::iterator triangle);
-        void updateQuadrangle(std::vector<std::array<int, 9>>::iterator hexahedron, std::vector<std::array<int, 5>>::iterator quadrangle);
-        void copyHexahedron(std::vector<std::array<int, 9>>::iterator hexahedron);
-        void copyPrism(std::vector<std::array<int, 7>>::iterator prism);
+        void buildFirstSection(const VertexElementAdjacency& adjacency);
+        void addVertex(GridIndex vertex, int section);
+        void updateTriangle(GridIndex prism, std::vector<std::array<GridIndex, 4>>::iterator triangle);
+        void updateQuadrangle(GridIndex hexahedron, std::vector<std::array<GridIndex, 5>>::iterator quadrangle);
+        void copyHexahedron(GridIndex hexahedron);
+        void copyPrism(GridIndex prism);
         void copyVertices();
         void fixVerticesIndices();
         void fixElementIndices();
@@ -45,17 +46,18 @@ class RadialGridDataReordered {
         int numberOfPrismsPerSegment;
         int numberOfHexahedronsPerSegment;
         int numberOfHexahedronsPerRadius;
-        int numberOfVerticesPerSection;
+        GridIndex numberOfVerticesPerSection;
 
-        std::vector<std::array<int, 9>> hexahedra;
-        std::vector<std::array<int, 7>> prisms;
-        std::vector<std::array<int, 4>> triangles;
-        std::vector<std::array<int, 5>> quadrangles;
+        std::vector<bool> copiedHexahedra;
+        std::vector<bool> copiedPrisms;
+        std::vector<bool> addedVertices;
+        std::vector<std::array<GridIndex, 4>> triangles;
+        std::vector<std::array<GridIndex, 5>> quadrangles;
 
-        std::vector<std::pair<int, int>> vertices;
+        std::vector<std::pair<GridIndex, GridIndex>> vertices;
 
-        int vertexShift = 0;
-        int elementShift = 0;
+        GridIndex vertexShift = 0;
+        GridIndex elementShift = 0;
 };
 
 #endif
@@ -38,10 +38,10 @@ class SegmentGridExtractor {
         int numberOfPrismsPerSegment;
         int numberOfHexahedronsPerSegment;
         int numberOfHexahedronsPerRadius;
-        int numberOfVerticesPerSection;
+        GridIndex numberOfVerticesPerSection;
 
-        int vertexShift = 0;
-        int elementShift = 0;
+        GridIndex vertexShift = 0;
+        GridIndex elementShift = 0;
 };
 
 #endif
@@ -0,0 +1,43 @@
+#ifndef VERTEX_MERGER_HPP
+#define VERTEX_MERGER_HPP
+
+#include <algorithm>
+#include <numeric>
+
+#include <BoostInterface/Filesystem.hpp>
+#include <BoostInterface/PropertyTree.hpp>
+#include <Grid/GridData.hpp>
+#include <Grid/SpatialIndex.hpp>
+#include <Utilities/Parallel.hpp>
+
+// Collapses every group of vertices closer than the tolerance into its lowest index, then renumbers the remaining vertices in their original order
+class VertexMerger {
+    public:
+        VertexMerger(boost::shared_ptr<GridData> gridData, std::string vertexMergerScript);
+
+        VertexMerger(boost::shared_ptr<GridData> gridData, boost::property_tree::ptree propertyTree);
+
+        VertexMerger(boost::shared_ptr<GridData> gridData, double tolerance);
+
+        ~VertexMerger() = default;
+
+        GridIndex numberOfMergedVertices = 0;
+
+    private:
+        void mergeVertices();
+        void checkGridData();
+        void findCoincidentVertices();
+        void checkElements();
+        void buildNewIndices();
+        void rewriteConnectivities();
+        void rewriteEntities();
+
+        boost::shared_ptr<GridData> gridData;
+        double tolerance;
+        int numberOfThreads = defaultNumberOfThreads();
+
+        std::vector<GridIndex> representatives;
+        std::vector<GridIndex> newIndices;
+};
+
+#endif
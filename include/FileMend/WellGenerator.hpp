@@ -10,6 +10,8 @@
 #include <BoostInterface/PropertyTree.hpp>
 #include <Utilities/Vector.hpp>
 #include <Grid/GridData.hpp>
+#include <Grid/VertexElementAdjacency.hpp>
+#include <Grid/SpatialIndex.hpp>
 
 struct WellGeneratorData {
     std::string regionName;
@@ -32,17 +34,18 @@ class WellGenerator {
         void checkGridData();
         void readScript();
         void generateWells();
-        void defineQuantities();
+        void defineQuantities(const VertexElementAdjacency& adjacency);
+        std::vector<GridIndex> findWellPrisms(const VertexElementAdjacency& adjacency, GridIndex vertex);
         bool isClose(const std::array<double, 3>& coordinate, const std::array<double, 3>& referencePoint);
 
         boost::shared_ptr<GridData> gridData;
         boost::property_tree::ptree propertyTree;
 
         std::vector<WellGeneratorData> wellGeneratorDatum;
-        int lineConnectivityShift;
+        GridIndex lineConnectivityShift;
 
-        int currentIndex = -1;
-        std::vector<std::vector<int>> prisms;
+        GridIndex currentIndex = -1;
+        std::vector<bool> wellPrisms;
         int numberOfElementsPerSection;
         int numberOfSegments;
         int numberOfPrisms;
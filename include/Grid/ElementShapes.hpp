@@ -0,0 +1,35 @@
+#ifndef GRID_ELEMENT_SHAPES_HPP
+#define GRID_ELEMENT_SHAPES_HPP
+
+// Local vertices of the faces of every element type in the CGNS face order with outward normals, padded with -1
+struct TetrahedronShape {
+    static const int numberOfVertices = 4;
+    static constexpr int faces[4][4] = {{0, 2, 1, -1}, {0, 1, 3, -1}, {1, 2, 3, -1}, {2, 0, 3, -1}};
+};
+
+struct HexahedronShape {
+    static const int numberOfVertices = 8;
+    static constexpr int faces[6][4] = {{0, 3, 2, 1}, {0, 1, 5, 4}, {1, 2, 6, 5}, {2, 3, 7, 6}, {0, 4, 7, 3}, {4, 5, 6, 7}};
+};
+
+struct PrismShape {
+    static const int numberOfVertices = 6;
+    static constexpr int faces[5][4] = {{0, 1, 4, 3}, {1, 2, 5, 4}, {2, 0, 3, 5}, {0, 2, 1, -1}, {3, 4, 5, -1}};
+};
+
+struct PyramidShape {
+    static const int numberOfVertices = 5;
+    static constexpr int faces[5][4] = {{0, 3, 2, 1}, {0, 1, 4, -1}, {1, 2, 4, -1}, {2, 3, 4, -1}, {3, 0, 4, -1}};
+};
+
+struct TriangleShape {
+    static const int numberOfVertices = 3;
+    static constexpr int faces[1][4] = {{0, 1, 2, -1}};
+};
+
+struct QuadrangleShape {
+    static const int numberOfVertices = 4;
+    static constexpr int faces[1][4] = {{0, 1, 2, 3}};
+};
+
+#endif
@@ -1,47 +1,76 @@
 #ifndef GRID_GRID_DATA_HPP
 #define GRID_GRID_DATA_HPP
 
+#include <cstdint>
 #include <vector>
 #include <array>
 #include <string>
 #include <BoostInterface/SharedPointer.hpp>
 
+// Vertex and element indices, 64-bit when the project is configured with GRID_64_BIT_INDICES
+#ifdef GRID_64_BIT_INDICES
+typedef std::int64_t GridIndex;
+#else
+typedef std::int32_t GridIndex;
+#endif
+
 struct RegionData {
     std::string name;
-    int elementBegin;
-    int elementEnd;
+    GridIndex elementBegin;
+    GridIndex elementEnd;
 };
 
 struct BoundaryData {
     std::string name;
-    int facetBegin;
-    int facetEnd;
-    std::vector<int> vertices;
+    GridIndex facetBegin;
+    GridIndex facetEnd;
+    std::vector<GridIndex> vertices;
 };
 
 struct WellData {
     std::string name;
-    int lineBegin;
-    int lineEnd;
-    std::vector<int> vertices;
+    GridIndex lineBegin;
+    GridIndex lineEnd;
+    std::vector<GridIndex> vertices;
 };
 
+struct VertexElementAdjacency;
+struct SpatialIndex;
+
 struct GridData {
     int dimension;
 
     std::vector<std::array<double, 3>> coordinates;
 
-    std::vector<std::array<int, 3>> lineConnectivity;
-    std::vector<std::array<int, 4>> triangleConnectivity;
-    std::vector<std::array<int, 5>> quadrangleConnectivity;
-    std::vector<std::array<int, 5>> tetrahedronConnectivity;
-    std::vector<std::array<int, 9>> hexahedronConnectivity;
-    std::vector<std::array<int, 7>> prismConnectivity;
-    std::vector<std::array<int, 6>> pyramidConnectivity;
+    std::vector<std::array<GridIndex, 3>> lineConnectivity;
+    std::vector<std::array<GridIndex, 4>> triangleConnectivity;
+    std::vector<std::array<GridIndex, 5>> quadrangleConnectivity;
+    std::vector<std::array<GridIndex, 5>> tetrahedronConnectivity;
+    std::vector<std::array<GridIndex, 9>> hexahedronConnectivity;
+    std::vector<std::array<GridIndex, 7>> prismConnectivity;
+    std::vector<std::array<GridIndex, 6>> pyramidConnectivity;
 
     std::vector<BoundaryData> boundaries;
     std::vector<RegionData> regions;
     std::vector<WellData> wells;
+
+    // Built on demand by getVertexElementAdjacency, reset it after rewriting volume connectivities in place
+    boost::shared_ptr<const VertexElementAdjacency> vertexElementAdjacency;
+
+    // Built on demand by getSpatialIndex, reset it after moving vertices in place
+    boost::shared_ptr<const SpatialIndex> spatialIndex;
 };
 
+// Calls function on every connectivity, from lines to pyramids
+template<class Function>
+void forEachConnectivity(GridData& gridData, Function&& function) {
+    function(gridData.lineConnectivity);
+    function(gridData.triangleConnectivity);
+    function(gridData.quadrangleConnectivity);
+    function(gridData.tetrahedronConnectivity);
+    function(gridData.hexahedronConnectivity);
+    function(gridData.prismConnectivity);
+    function(gridData.pyramidConnectivity);
+}
+
 #endif
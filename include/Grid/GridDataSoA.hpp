@@ -0,0 +1,124 @@
+#ifndef GRID_GRID_DATA_SOA_HPP
+#define GRID_GRID_DATA_SOA_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include <Grid/GridData.hpp>
+
+// Vertices of element i are vertices[N*i, N*i+N) and its global index is indices[i]
+template<int N>
+struct ElementArrays {
+    static const int numberOfVertices = N;
+
+    std::vector<GridIndex> vertices;
+    std::vector<GridIndex> indices;
+
+    GridIndex size() const {
+        return this->indices.size();
+    }
+
+    const GridIndex* element(GridIndex i) const {
+        return this->vertices.data() + N * i;
+    }
+};
+
+// Structure of arrays counterpart of GridData: the coordinates and the vertices of every element type are contiguous and the global indices live apart
+struct GridDataSoA {
+    int dimension;
+
+    std::vector<double> coordinatesX;
+    std::vector<double> coordinatesY;
+    std::vector<double> coordinatesZ;
+
+    ElementArrays<2> lineConnectivity;
+    ElementArrays<3> triangleConnectivity;
+    ElementArrays<4> quadrangleConnectivity;
+    ElementArrays<4> tetrahedronConnectivity;
+    ElementArrays<8> hexahedronConnectivity;
+    ElementArrays<6> prismConnectivity;
+    ElementArrays<5> pyramidConnectivity;
+
+    std::vector<BoundaryData> boundaries;
+    std::vector<RegionData> regions;
+    std::vector<WellData> wells;
+};
+
+// Splits the coordinates of the vertices [begin, end) into the coordinate arrays, coordinate(vertex) gives the x, y and z of a vertex
+template<class Coordinate>
+void gatherCoordinates(GridIndex begin, GridIndex end, Coordinate&& coordinate, GridDataSoA& gridDataSoA) {
+    gridDataSoA.coordinatesX.resize(end - begin);
+    gridDataSoA.coordinatesY.resize(end - begin);
+    gridDataSoA.coordinatesZ.resize(end - begin);
+    for (GridIndex vertex = begin; vertex < end; vertex++) {
+        const std::array<double, 3>& values = coordinate(vertex);
+        gridDataSoA.coordinatesX[vertex - begin] = values[0];
+        gridDataSoA.coordinatesY[vertex - begin] = values[1];
+        gridDataSoA.coordinatesZ[vertex - begin] = values[2];
+    }
+}
+
+template<int N>
+void toElementArrays(const std::vector<std::array<GridIndex, N+1>>& connectivity, ElementArrays<N>& elements) {
+    elements.vertices.resize(N * connectivity.size());
+    elements.indices.resize(connectivity.size());
+    for (std::size_t i = 0; i < connectivity.size(); i++) {
+        std::copy_n(connectivity[i].cbegin(), N, elements.vertices.begin() + N * i);
+        elements.indices[i] = connectivity[i].back();
+    }
+}
+
+template<int N>
+void fromElementArrays(const ElementArrays<N>& elements, std::vector<std::array<GridIndex, N+1>>& connectivity) {
+    connectivity.resize(elements.size());
+    for (GridIndex i = 0; i < elements.size(); i++) {
+        std::copy_n(elements.element(i), N, connectivity[i].begin());
+        connectivity[i].back() = elements.indices[i];
+    }
+}
+
+inline boost::shared_ptr<GridDataSoA> toStructureOfArrays(const GridData& gridData) {
+    auto gridDataSoA = boost::make_shared<GridDataSoA>();
+    gridDataSoA->dimension = gridData.dimension;
+
+    gatherCoordinates(0, gridData.coordinates.size(), [&](GridIndex vertex) -> const std::array<double, 3>& {return gridData.coordinates[vertex];}, *gridDataSoA);
+
+    toElementArrays(gridData.lineConnectivity, gridDataSoA->lineConnectivity);
+    toElementArrays(gridData.triangleConnectivity, gridDataSoA->triangleConnectivity);
+    toElementArrays(gridData.quadrangleConnectivity, gridDataSoA->quadrangleConnectivity);
+    toElementArrays(gridData.tetrahedronConnectivity, gridDataSoA->tetrahedronConnectivity);
+    toElementArrays(gridData.hexahedronConnectivity, gridDataSoA->hexahedronConnectivity);
+    toElementArrays(gridData.prismConnectivity, gridDataSoA->prismConnectivity);
+    toElementArrays(gridData.pyramidConnectivity, gridDataSoA->pyramidConnectivity);
+
+    gridDataSoA->boundaries = gridData.boundaries;
+    gridDataSoA->regions = gridData.regions;
+    gridDataSoA->wells = gridData.wells;
+    return gridDataSoA;
+}
+
+inline boost::shared_ptr<GridData> toArrayOfStructures(const GridDataSoA& gridDataSoA) {
+    if (gridDataSoA.coordinatesY.size() != gridDataSoA.coordinatesX.size() || gridDataSoA.coordinatesZ.size() != gridDataSoA.coordinatesX.size())
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The coordinate arrays must have the same size");
+
+    auto gridData = boost::make_shared<GridData>();
+    gridData->dimension = gridDataSoA.dimension;
+
+    gridData->coordinates.resize(gridDataSoA.coordinatesX.size());
+    for (std::size_t i = 0; i < gridData->coordinates.size(); i++)
+        gridData->coordinates[i] = {gridDataSoA.coordinatesX[i], gridDataSoA.coordinatesY[i], gridDataSoA.coordinatesZ[i]};
+
+    fromElementArrays(gridDataSoA.lineConnectivity, gridData->lineConnectivity);
+    fromElementArrays(gridDataSoA.triangleConnectivity, gridData->triangleConnectivity);
+    fromElementArrays(gridDataSoA.quadrangleConnectivity, gridData->quadrangleConnectivity);
+    fromElementArrays(gridDataSoA.tetrahedronConnectivity, gridData->tetrahedronConnectivity);
+    fromElementArrays(gridDataSoA.hexahedronConnectivity, gridData->hexahedronConnectivity);
+    fromElementArrays(gridDataSoA.prismConnectivity, gridData->prismConnectivity);
+    fromElementArrays(gridDataSoA.pyramidConnectivity, gridData->pyramidConnectivity);
+
+    gridData->boundaries = gridDataSoA.boundaries;
+    gridData->regions = gridDataSoA.regions;
+    gridData->wells = gridDataSoA.wells;
+    return gridData;
+}
+
+#endif
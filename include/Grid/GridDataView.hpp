@@ -0,0 +1,178 @@
+#ifndef GRID_GRID_DATA_VIEW_HPP
+#define GRID_GRID_DATA_VIEW_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include <Grid/GridData.hpp>
+#include <Utilities/Parallel.hpp>
+
+// Parent elements with global index in [parentBegin, parentEnd) are the view elements from localBegin on
+struct GridDataViewRange {
+    GridIndex parentBegin;
+    GridIndex parentEnd;
+    GridIndex localBegin;
+};
+
+// A subgrid that reads the coordinates and connectivities of its parent instead of copying them.
+// The selected regions, boundaries and wells are renumbered contiguously in that order, and vertex i of the view is the parent vertex vertices[i], or the parent vertex i itself when vertices is empty.
+class GridDataView {
+    public:
+        // Every region, boundary and well of the parent, keeping all of its vertices
+        explicit GridDataView(boost::shared_ptr<GridData> parent) : parent(parent), layout(boost::make_shared<GridData>()) {
+            this->select(this->parent->regions, this->parent->boundaries, this->parent->wells);
+        }
+
+        // The named entities of the parent and only the vertices their elements use
+        GridDataView(boost::shared_ptr<GridData> parent, const std::vector<std::string>& regionNames, const std::vector<std::string>& boundaryNames, const std::vector<std::string>& wellNames) : parent(parent), layout(boost::make_shared<GridData>()) {
+            this->select(findEntities(this->parent->regions, regionNames, "region"), findEntities(this->parent->boundaries, boundaryNames, "boundary"), findEntities(this->parent->wells, wellNames, "well"));
+            this->markVertices();
+        }
+
+        boost::shared_ptr<GridData> getParent() const {
+            return this->parent;
+        }
+
+        // Dimension and entities of the view in its own numbering, without coordinates or connectivities
+        boost::shared_ptr<GridData> getLayout() const {
+            return this->layout;
+        }
+
+        GridIndex getNumberOfVertices() const {
+            return this->vertices.empty() ? GridIndex(this->parent->coordinates.size()) : GridIndex(this->vertices.size());
+        }
+
+        GridIndex getNumberOfElements() const {
+            return this->numberOfElements;
+        }
+
+        const std::array<double, 3>& getCoordinate(GridIndex vertex) const {
+            return this->parent->coordinates[this->vertices.empty() ? vertex : this->vertices[vertex]];
+        }
+
+        GridIndex getLocalVertex(GridIndex parentVertex) const {
+            if (this->vertices.empty())
+                return parentVertex;
+
+            auto vertex = std::lower_bound(this->vertices.cbegin(), this->vertices.cend(), parentVertex);
+            if (vertex == this->vertices.cend() || *vertex != parentVertex)
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Vertex " + std::to_string(parentVertex) + " is not in the view");
+            return vertex - this->vertices.cbegin();
+        }
+
+        // Local index of a parent element, or -1 if the view does not select it
+        GridIndex getLocalElement(GridIndex parentElement) const {
+            auto range = std::upper_bound(this->ranges.cbegin(), this->ranges.cend(), parentElement, [](GridIndex index, const auto& r) {return index < r.parentBegin;});
+            if (range == this->ranges.cbegin() || parentElement >= (--range)->parentEnd)
+                return -1;
+            return range->localBegin + parentElement - range->parentBegin;
+        }
+
+        GridIndex getParentElement(GridIndex localElement) const {
+            auto range = std::find_if(this->ranges.cbegin(), this->ranges.cend(), [=](const auto& r) {return localElement >= r.localBegin && localElement < r.localBegin + r.parentEnd - r.parentBegin;});
+            if (range == this->ranges.cend())
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Element " + std::to_string(localElement) + " is not in the view");
+            return range->parentBegin + localElement - range->localBegin;
+        }
+
+        // Calls function(localElement, parentVertices, numberOfVertices) once for every selected element, in parent storage order
+        template<class Function>
+        void forEachElement(Function&& function) const {
+            this->forEachElement(this->parent->tetrahedronConnectivity, function);
+            this->forEachElement(this->parent->hexahedronConnectivity, function);
+            this->forEachElement(this->parent->prismConnectivity, function);
+            this->forEachElement(this->parent->pyramidConnectivity, function);
+            this->forEachElement(this->parent->triangleConnectivity, function);
+            this->forEachElement(this->parent->quadrangleConnectivity, function);
+            this->forEachElement(this->parent->lineConnectivity, function);
+        }
+
+        // The same calls split in chunks of every connectivity run concurrently, so the function may only write state owned by its element
+        template<class Function>
+        void forEachElement(Function&& function, int numberOfThreads) const {
+            forEachConnectivity(*this->parent, [&](const auto& connectivity) {
+                GridIndex size = connectivity.size();
+                int numberOfChunks = std::max(GridIndex(1), std::min(GridIndex(numberOfThreads) * 4, size));
+                parallelFor(numberOfChunks, numberOfThreads, [&](int chunk) {
+                    for (GridIndex i = long(size) * chunk / numberOfChunks; i < long(size) * (chunk + 1) / numberOfChunks; i++) {
+                        GridIndex local = this->getLocalElement(connectivity[i].back());
+                        if (local != -1)
+                            function(local, connectivity[i].data(), int(connectivity[i].size()) - 1);
+                    }
+                });
+            });
+        }
+
+    private:
+        template<class Entity>
+        static std::vector<Entity> findEntities(const std::vector<Entity>& entities, const std::vector<std::string>& names, std::string kind) {
+            std::vector<Entity> found;
+            for (auto name : names) {
+                auto entity = std::find_if(entities.cbegin(), entities.cend(), [=](const auto& e){return e.name == name;});
+                if (entity == entities.cend())
+                    throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - There is no " + kind + " " + name + " in gridData");
+                found.emplace_back(*entity);
+            }
+            return found;
+        }
+
+        void addRange(GridIndex& begin, GridIndex& end) {
+            this->ranges.emplace_back(GridDataViewRange{begin, end, this->numberOfElements});
+            begin = this->numberOfElements;
+            this->numberOfElements += end - this->ranges.back().parentBegin;
+            end = this->numberOfElements;
+        }
+
+        void select(std::vector<RegionData> regions, std::vector<BoundaryData> boundaries, std::vector<WellData> wells) {
+            this->layout->dimension = this->parent->dimension;
+            for (auto& region : regions)
+                this->addRange(region.elementBegin, region.elementEnd);
+            for (auto& boundary : boundaries)
+                this->addRange(boundary.facetBegin, boundary.facetEnd);
+            for (auto& well : wells)
+                this->addRange(well.lineBegin, well.lineEnd);
+
+            std::sort(this->ranges.begin(), this->ranges.end(), [](const auto& a, const auto& b) {return a.parentBegin < b.parentBegin;});
+            for (unsigned i = 1; i < this->ranges.size(); i++)
+                if (this->ranges[i].parentBegin < this->ranges[i - 1].parentEnd)
+                    throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The selected entities overlap at element " + std::to_string(this->ranges[i].parentBegin));
+
+            this->layout->regions = std::move(regions);
+            this->layout->boundaries = std::move(boundaries);
+            this->layout->wells = std::move(wells);
+        }
+
+        void markVertices() {
+            std::vector<bool> marked(this->parent->coordinates.size(), false);
+            this->forEachElement([&](GridIndex, const GridIndex* vertices, int numberOfVertices) {
+                for (int i = 0; i < numberOfVertices; i++)
+                    marked[vertices[i]] = true;
+            });
+            for (GridIndex vertex = 0; vertex < GridIndex(marked.size()); vertex++)
+                if (marked[vertex])
+                    this->vertices.push_back(vertex);
+
+            for (auto& boundary : this->layout->boundaries)
+                for (auto& vertex : boundary.vertices)
+                    vertex = this->getLocalVertex(vertex);
+            for (auto& well : this->layout->wells)
+                for (auto& vertex : well.vertices)
+                    vertex = this->getLocalVertex(vertex);
+        }
+
+        template<class Connectivity, class Function>
+        void forEachElement(const Connectivity& connectivity, Function& function) const {
+            for (const auto& element : connectivity) {
+                GridIndex local = this->getLocalElement(element.back());
+                if (local != -1)
+                    function(local, element.data(), int(element.size()) - 1);
+            }
+        }
+
+        boost::shared_ptr<GridData> parent;
+        boost::shared_ptr<GridData> layout;
+        std::vector<GridDataViewRange> ranges;
+        std::vector<GridIndex> vertices;
+        GridIndex numberOfElements = 0;
+};
+
+#endif
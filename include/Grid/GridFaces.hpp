@@ -0,0 +1,226 @@
+#ifndef GRID_GRID_FACES_HPP
+#define GRID_GRID_FACES_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <Grid/ElementShapes.hpp>
+#include <Grid/GridData.hpp>
+#include <Utilities/Parallel.hpp>
+
+// Every face of the volume elements once, the internal faces first and sorted by owner, then the boundary faces.
+// Face f has the vertices vertices[offsets[f], offsets[f+1]) in the order of its owner, so its normal points out of the owner.
+// Owners and neighbours are global element indices and the neighbour of a boundary face is -1.
+// ownerFaces and neighbourFaces are the 1-based positions of the face in the CGNS face numbering of each element.
+struct GridFaces {
+    std::vector<GridIndex> offsets;
+    std::vector<GridIndex> vertices;
+    std::vector<GridIndex> owners;
+    std::vector<GridIndex> neighbours;
+    std::vector<int> ownerFaces;
+    std::vector<int> neighbourFaces;
+    GridIndex numberOfInternalFaces;
+
+    // Global index of the triangle or quadrangle lying on every boundary face, or -1
+    std::vector<GridIndex> boundaryFacets;
+
+    GridIndex size() const {
+        return this->owners.size();
+    }
+};
+
+typedef std::vector<std::vector<int>> FaceTable;
+
+// The faces of the element shapes without their -1 padding
+template<class Shape>
+const FaceTable& faceTable() {
+    static const FaceTable table = []() {
+        FaceTable faces;
+        for (const auto& face : Shape::faces) {
+            faces.emplace_back();
+            for (int vertex : face)
+                if (vertex >= 0)
+                    faces.back().push_back(vertex);
+        }
+        return faces;
+    }();
+    return table;
+}
+
+inline const FaceTable& tetrahedronFaceTable() {
+    return faceTable<TetrahedronShape>();
+}
+
+inline const FaceTable& hexahedronFaceTable() {
+    return faceTable<HexahedronShape>();
+}
+
+inline const FaceTable& prismFaceTable() {
+    return faceTable<PrismShape>();
+}
+
+inline const FaceTable& pyramidFaceTable() {
+    return faceTable<PyramidShape>();
+}
+
+inline const FaceTable& facetFaceTable(int numberOfVertices) {
+    return numberOfVertices == 3 ? faceTable<TriangleShape>() : faceTable<QuadrangleShape>();
+}
+
+// A face of an element, or a facet when face is -1, keyed by its sorted vertices
+struct FaceRecord {
+    std::array<GridIndex, 4> key;
+    int type;
+    GridIndex element;
+    int face;
+};
+
+struct FaceKeyHash {
+    std::size_t operator()(const std::array<GridIndex, 4>& key) const {
+        std::uint64_t hash = 0xcbf29ce484222325ull;
+        for (GridIndex vertex : key)
+            hash = (hash ^ std::uint64_t(vertex)) * 0x100000001b3ull;
+        return hash ^ (hash >> 29);
+    }
+};
+
+// Faces are hashed into partitions while the elements are read in parallel chunks, then every partition pairs its faces on its own.
+// The chunks of a partition are visited in storage order, so the owner is always the first element holding the face and the result does not depend on the number of threads.
+inline GridFaces buildGridFaces(const GridData& gridData, int numberOfThreads = defaultNumberOfThreads()) {
+    enum {tetrahedra, hexahedra, prisms, pyramids, triangles, quadrangles};
+    auto visit = [&](int type, auto&& function) {
+        switch (type) {
+            case tetrahedra : return function(gridData.tetrahedronConnectivity, tetrahedronFaceTable());
+            case hexahedra  : return function(gridData.hexahedronConnectivity, hexahedronFaceTable());
+            case prisms     : return function(gridData.prismConnectivity, prismFaceTable());
+            case pyramids   : return function(gridData.pyramidConnectivity, pyramidFaceTable());
+            case triangles  : return function(gridData.triangleConnectivity, facetFaceTable(3));
+            default         : return function(gridData.quadrangleConnectivity, facetFaceTable(4));
+        }
+    };
+
+    auto globalIndex = [&](const FaceRecord& record) {
+        return visit(record.type, [&](const auto& connectivity, const FaceTable&) {return connectivity[record.element].back();});
+    };
+
+    struct Chunk {
+        int type;
+        GridIndex begin;
+        GridIndex end;
+    };
+    std::vector<Chunk> chunks;
+    for (int type = tetrahedra; type <= quadrangles; type++) {
+        GridIndex size = visit(type, [](const auto& connectivity, const FaceTable&) {return GridIndex(connectivity.size());});
+        int numberOfChunks = std::min(GridIndex(numberOfThreads) * 4, size);
+        for (int chunk = 0; chunk < numberOfChunks; chunk++)
+            chunks.emplace_back(Chunk{type, GridIndex(long(size) * chunk / numberOfChunks), GridIndex(long(size) * (chunk + 1) / numberOfChunks)});
+    }
+
+    int numberOfPartitions = std::max(1, numberOfThreads * 4);
+    std::vector<std::vector<std::vector<FaceRecord>>> buckets(chunks.size(), std::vector<std::vector<FaceRecord>>(numberOfPartitions));
+    parallelFor(int(chunks.size()), numberOfThreads, [&](int chunk) {
+        visit(chunks[chunk].type, [&](const auto& connectivity, const FaceTable& table) {
+            for (GridIndex element = chunks[chunk].begin; element < chunks[chunk].end; element++)
+                for (int face = 0; face < int(table.size()); face++) {
+                    FaceRecord record{{-1, -1, -1, -1}, chunks[chunk].type, element, chunks[chunk].type >= triangles ? -1 : face};
+                    for (unsigned vertex = 0; vertex < table[face].size(); vertex++) {
+                        unsigned position = vertex;
+                        for (; position > 0 && record.key[position - 1] > connectivity[element][table[face][vertex]]; position--)
+                            record.key[position] = record.key[position - 1];
+                        record.key[position] = connectivity[element][table[face][vertex]];
+                    }
+                    buckets[chunk][FaceKeyHash()(record.key) % numberOfPartitions].emplace_back(std::move(record));
+                }
+        });
+    });
+
+    struct FacePair {
+        FaceRecord owner;
+        FaceRecord neighbour;
+        GridIndex facet;
+    };
+    // Open addressing tables indexed by the hash bits the partition did not use
+    std::vector<std::vector<FacePair>> pairs(numberOfPartitions);
+    parallelFor(numberOfPartitions, numberOfThreads, [&](int partition) {
+        std::size_t numberOfRecords = 0;
+        for (const auto& bucket : buckets)
+            numberOfRecords += bucket[partition].size();
+
+        std::size_t mask = 1;
+        while (mask < 2 * numberOfRecords)
+            mask <<= 1;
+        std::vector<GridIndex> table(mask--, -1);
+        auto find = [&](const std::array<GridIndex, 4>& key) -> GridIndex& {
+            std::size_t slot = (FaceKeyHash()(key) / numberOfPartitions) & mask;
+            while (table[slot] != -1 && pairs[partition][table[slot]].owner.key != key)
+                slot = (slot + 1) & mask;
+            return table[slot];
+        };
+
+        pairs[partition].reserve(numberOfRecords / 2 + 1);
+        for (const auto& bucket : buckets)
+            for (const auto& record : bucket[partition]) {
+                if (record.face == -1)
+                    continue;
+
+                GridIndex& face = find(record.key);
+                if (face == -1) {
+                    face = pairs[partition].size();
+                    pairs[partition].emplace_back(FacePair{record, FaceRecord{record.key, -1, -1, -1}, -1});
+                }
+                else if (pairs[partition][face].neighbour.type == -1)
+                    pairs[partition][face].neighbour = record;
+                else
+                    throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - A face is shared by more than two elements");
+            }
+
+        for (const auto& bucket : buckets)
+            for (const auto& record : bucket[partition]) {
+                GridIndex face = record.face == -1 ? find(record.key) : -1;
+                if (face != -1 && pairs[partition][face].neighbour.type == -1)
+                    pairs[partition][face].facet = globalIndex(record);
+            }
+    });
+    buckets.clear();
+
+    // Internal faces first, each group in the storage order of the owner face
+    std::vector<std::uint64_t> cellBegin(pyramids + 2, 0);
+    for (int type = tetrahedra; type <= pyramids; type++)
+        cellBegin[type + 1] = cellBegin[type] + visit(type, [](const auto& connectivity, const FaceTable&) {return connectivity.size();});
+
+    struct FaceOrder {
+        std::uint64_t order;
+        int partition;
+        GridIndex face;
+    };
+    std::vector<FaceOrder> orders;
+    for (int partition = 0; partition < numberOfPartitions; partition++)
+        for (GridIndex face = 0; face < GridIndex(pairs[partition].size()); face++) {
+            const FacePair& pair = pairs[partition][face];
+            std::uint64_t boundary = pair.neighbour.type == -1 ? 1ull << 63 : 0;
+            orders.emplace_back(FaceOrder{boundary | ((cellBegin[pair.owner.type] + pair.owner.element) * 8 + pair.owner.face), partition, face});
+        }
+    std::sort(orders.begin(), orders.end(), [](const auto& a, const auto& b) {return a.order < b.order;});
+
+    GridFaces gridFaces;
+    gridFaces.numberOfInternalFaces = std::count_if(orders.cbegin(), orders.cend(), [](const auto& order) {return order.order >> 63 == 0;});
+    gridFaces.offsets.reserve(orders.size() + 1);
+    gridFaces.offsets.push_back(0);
+    for (const auto& order : orders) {
+        const FacePair& pair = pairs[order.partition][order.face];
+        visit(pair.owner.type, [&](const auto& connectivity, const FaceTable& table) {
+            for (int vertex : table[pair.owner.face])
+                gridFaces.vertices.push_back(connectivity[pair.owner.element][vertex]);
+        });
+        gridFaces.offsets.push_back(gridFaces.vertices.size());
+        gridFaces.owners.push_back(globalIndex(pair.owner));
+        gridFaces.ownerFaces.push_back(pair.owner.face + 1);
+        gridFaces.neighbours.push_back(pair.neighbour.type == -1 ? -1 : globalIndex(pair.neighbour));
+        gridFaces.neighbourFaces.push_back(pair.neighbour.face + 1);
+        if (pair.neighbour.type == -1)
+            gridFaces.boundaryFacets.push_back(pair.facet);
+    }
+    return gridFaces;
+}
+
+#endif
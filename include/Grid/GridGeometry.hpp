@@ -0,0 +1,196 @@
+#ifndef GRID_GRID_GEOMETRY_HPP
+#define GRID_GRID_GEOMETRY_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <Grid/ElementShapes.hpp>
+#include <Grid/GridDataSoA.hpp>
+#include <Utilities/Parallel.hpp>
+
+// Volumes and centroids of the volume elements indexed by their global index, which must lie in [0, number of volume elements).
+// Facet areas, unit normals and centroids are indexed by the global index minus facetBegin, the number of volume elements.
+struct GridGeometry {
+    std::vector<double> volumes;
+    std::array<std::vector<double>, 3> centroids;
+
+    GridIndex facetBegin;
+    std::vector<double> facetAreas;
+    std::array<std::vector<double>, 3> facetNormals;
+    std::array<std::vector<double>, 3> facetCentroids;
+};
+
+// Elements are processed in batches whose coordinates are gathered into lanes, so every kernel loop runs over contiguous lanes without branches
+const int geometryBatchSize = 16;
+
+struct GeometryLanes {
+    double x[geometryBatchSize];
+    double y[geometryBatchSize];
+    double z[geometryBatchSize];
+};
+
+template<int N, class Function>
+void forEachGeometryBatch(const GridDataSoA& gridDataSoA, const ElementArrays<N>& elements, int numberOfThreads, Function&& function) {
+    GridIndex numberOfBatches = (elements.size() + geometryBatchSize - 1) / geometryBatchSize;
+    int numberOfChunks = std::max(GridIndex(1), std::min(GridIndex(numberOfThreads) * 4, numberOfBatches));
+    parallelFor(numberOfChunks, numberOfThreads, [&](int chunk) {
+        GeometryLanes points[N];
+        for (GridIndex batch = long(numberOfBatches) * chunk / numberOfChunks; batch < long(numberOfBatches) * (chunk + 1) / numberOfChunks; batch++) {
+            GridIndex first = batch * geometryBatchSize;
+            int numberOfLanes = std::min(GridIndex(geometryBatchSize), elements.size() - first);
+            for (int vertex = 0; vertex < N; vertex++)
+                for (int lane = 0; lane < geometryBatchSize; lane++) {
+                    GridIndex index = elements.vertices[N * (first + std::min(lane, numberOfLanes - 1)) + vertex];
+                    points[vertex].x[lane] = gridDataSoA.coordinatesX[index];
+                    points[vertex].y[lane] = gridDataSoA.coordinatesY[index];
+                    points[vertex].z[lane] = gridDataSoA.coordinatesZ[index];
+                }
+            function(first, numberOfLanes, points);
+        }
+    });
+}
+
+inline void averageLanes(const GeometryLanes* points, const int* vertices, int numberOfVertices, GeometryLanes& average) {
+    for (int lane = 0; lane < geometryBatchSize; lane++) {
+        average.x[lane] = 0.0;
+        average.y[lane] = 0.0;
+        average.z[lane] = 0.0;
+    }
+    for (int vertex = 0; vertex < numberOfVertices; vertex++)
+        for (int lane = 0; lane < geometryBatchSize; lane++) {
+            average.x[lane] += points[vertices[vertex]].x[lane] / numberOfVertices;
+            average.y[lane] += points[vertices[vertex]].y[lane] / numberOfVertices;
+            average.z[lane] += points[vertices[vertex]].z[lane] / numberOfVertices;
+        }
+}
+
+// Adds the tetrahedron joining the outward triangle abc to the apex inside the cell
+inline void addTetrahedron(const GeometryLanes& a, const GeometryLanes& b, const GeometryLanes& c, const GeometryLanes& apex, double* volumes, GeometryLanes& moments) {
+    for (int lane = 0; lane < geometryBatchSize; lane++) {
+        double abX = b.x[lane] - a.x[lane], abY = b.y[lane] - a.y[lane], abZ = b.z[lane] - a.z[lane];
+        double acX = c.x[lane] - a.x[lane], acY = c.y[lane] - a.y[lane], acZ = c.z[lane] - a.z[lane];
+        double apX = a.x[lane] - apex.x[lane], apY = a.y[lane] - apex.y[lane], apZ = a.z[lane] - apex.z[lane];
+        double volume = ((abY * acZ - abZ * acY) * apX + (abZ * acX - abX * acZ) * apY + (abX * acY - abY * acX) * apZ) / 6.0;
+        volumes[lane] += volume;
+        moments.x[lane] += volume * (a.x[lane] + b.x[lane] + c.x[lane] + apex.x[lane]) / 4.0;
+        moments.y[lane] += volume * (a.y[lane] + b.y[lane] + c.y[lane] + apex.y[lane]) / 4.0;
+        moments.z[lane] += volume * (a.z[lane] + b.z[lane] + c.z[lane] + apex.z[lane]) / 4.0;
+    }
+}
+
+// Every face is split into triangles around its center and joined to the vertex average of the cell, which is exact for planar faces
+template<class Shape>
+void computeCellGeometry(const GridDataSoA& gridDataSoA, const ElementArrays<Shape::numberOfVertices>& elements, GridGeometry& geometry, int numberOfThreads) {
+    const int N = Shape::numberOfVertices;
+    const int numberOfFaces = sizeof(Shape::faces) / sizeof(Shape::faces[0]);
+    int cellVertices[N];
+    for (int vertex = 0; vertex < N; vertex++)
+        cellVertices[vertex] = vertex;
+
+    forEachGeometryBatch(gridDataSoA, elements, numberOfThreads, [&](GridIndex first, int numberOfLanes, const GeometryLanes* points) {
+        GeometryLanes center, faceCenter, moments{};
+        double volumes[geometryBatchSize] = {};
+        averageLanes(points, cellVertices, N, center);
+
+        for (int face = 0; face < numberOfFaces; face++) {
+            const int* vertices = Shape::faces[face];
+            if (vertices[3] == -1)
+                addTetrahedron(points[vertices[0]], points[vertices[1]], points[vertices[2]], center, volumes, moments);
+            else {
+                averageLanes(points, vertices, 4, faceCenter);
+                for (int edge = 0; edge < 4; edge++)
+                    addTetrahedron(points[vertices[edge]], points[vertices[(edge + 1) % 4]], faceCenter, center, volumes, moments);
+            }
+        }
+
+        for (int lane = 0; lane < numberOfLanes; lane++) {
+            GridIndex index = elements.indices[first + lane];
+            if (index < 0 || index >= GridIndex(geometry.volumes.size()))
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Element " + std::to_string(index) + " is not numbered before the facets");
+            geometry.volumes[index] = volumes[lane];
+            geometry.centroids[0][index] = moments.x[lane] / volumes[lane];
+            geometry.centroids[1][index] = moments.y[lane] / volumes[lane];
+            geometry.centroids[2][index] = moments.z[lane] / volumes[lane];
+        }
+    });
+}
+
+// Quadrangles are split into four triangles around their center, the normals follow the vertex order
+template<class Shape>
+void computeFacetGeometry(const GridDataSoA& gridDataSoA, const ElementArrays<Shape::numberOfVertices>& elements, GridGeometry& geometry, int numberOfThreads) {
+    const int N = Shape::numberOfVertices;
+    int facetVertices[N];
+    for (int vertex = 0; vertex < N; vertex++)
+        facetVertices[vertex] = vertex;
+
+    forEachGeometryBatch(gridDataSoA, elements, numberOfThreads, [&](GridIndex first, int numberOfLanes, const GeometryLanes* points) {
+        GeometryLanes center, areas{}, moments{};
+        double weights[geometryBatchSize] = {};
+        averageLanes(points, facetVertices, N, center);
+
+        const int numberOfTriangles = N == 3 ? 1 : N;
+        for (int triangle = 0; triangle < numberOfTriangles; triangle++) {
+            const GeometryLanes& a = points[N == 3 ? 0 : triangle];
+            const GeometryLanes& b = points[N == 3 ? 1 : (triangle + 1) % N];
+            const GeometryLanes& c = N == 3 ? points[2] : center;
+            for (int lane = 0; lane < geometryBatchSize; lane++) {
+                double abX = b.x[lane] - a.x[lane], abY = b.y[lane] - a.y[lane], abZ = b.z[lane] - a.z[lane];
+                double acX = c.x[lane] - a.x[lane], acY = c.y[lane] - a.y[lane], acZ = c.z[lane] - a.z[lane];
+                double areaX = 0.5 * (abY * acZ - abZ * acY), areaY = 0.5 * (abZ * acX - abX * acZ), areaZ = 0.5 * (abX * acY - abY * acX);
+                double area = std::sqrt(areaX * areaX + areaY * areaY + areaZ * areaZ);
+                areas.x[lane] += areaX;
+                areas.y[lane] += areaY;
+                areas.z[lane] += areaZ;
+                weights[lane] += area;
+                moments.x[lane] += area * (a.x[lane] + b.x[lane] + c.x[lane]) / 3.0;
+                moments.y[lane] += area * (a.y[lane] + b.y[lane] + c.y[lane]) / 3.0;
+                moments.z[lane] += area * (a.z[lane] + b.z[lane] + c.z[lane]) / 3.0;
+            }
+        }
+
+        for (int lane = 0; lane < numberOfLanes; lane++) {
+            GridIndex index = elements.indices[first + lane] - geometry.facetBegin;
+            if (index < 0 || index >= GridIndex(geometry.facetAreas.size()))
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Facet " + std::to_string(elements.indices[first + lane]) + " is not numbered right after the volume elements");
+            double area = std::sqrt(areas.x[lane] * areas.x[lane] + areas.y[lane] * areas.y[lane] + areas.z[lane] * areas.z[lane]);
+            geometry.facetAreas[index] = area;
+            geometry.facetNormals[0][index] = areas.x[lane] / area;
+            geometry.facetNormals[1][index] = areas.y[lane] / area;
+            geometry.facetNormals[2][index] = areas.z[lane] / area;
+            geometry.facetCentroids[0][index] = moments.x[lane] / weights[lane];
+            geometry.facetCentroids[1][index] = moments.y[lane] / weights[lane];
+            geometry.facetCentroids[2][index] = moments.z[lane] / weights[lane];
+        }
+    });
+}
+
+inline GridGeometry computeGridGeometry(const GridDataSoA& gridDataSoA, int numberOfThreads = defaultNumberOfThreads()) {
+    if (gridDataSoA.dimension != 3)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - gridData dimension must be 3 and not " + std::to_string(gridDataSoA.dimension));
+
+    GridGeometry geometry;
+    geometry.facetBegin = gridDataSoA.tetrahedronConnectivity.size() + gridDataSoA.hexahedronConnectivity.size() + gridDataSoA.prismConnectivity.size() + gridDataSoA.pyramidConnectivity.size();
+    GridIndex numberOfFacets = gridDataSoA.triangleConnectivity.size() + gridDataSoA.quadrangleConnectivity.size();
+
+    geometry.volumes.resize(geometry.facetBegin);
+    geometry.facetAreas.resize(numberOfFacets);
+    for (int axis = 0; axis < 3; axis++) {
+        geometry.centroids[axis].resize(geometry.facetBegin);
+        geometry.facetNormals[axis].resize(numberOfFacets);
+        geometry.facetCentroids[axis].resize(numberOfFacets);
+    }
+
+    computeCellGeometry<TetrahedronShape>(gridDataSoA, gridDataSoA.tetrahedronConnectivity, geometry, numberOfThreads);
+    computeCellGeometry<HexahedronShape>(gridDataSoA, gridDataSoA.hexahedronConnectivity, geometry, numberOfThreads);
+    computeCellGeometry<PrismShape>(gridDataSoA, gridDataSoA.prismConnectivity, geometry, numberOfThreads);
+    computeCellGeometry<PyramidShape>(gridDataSoA, gridDataSoA.pyramidConnectivity, geometry, numberOfThreads);
+    computeFacetGeometry<TriangleShape>(gridDataSoA, gridDataSoA.triangleConnectivity, geometry, numberOfThreads);
+    computeFacetGeometry<QuadrangleShape>(gridDataSoA, gridDataSoA.quadrangleConnectivity, geometry, numberOfThreads);
+    return geometry;
+}
+
+inline GridGeometry computeGridGeometry(const GridData& gridData, int numberOfThreads = defaultNumberOfThreads()) {
+    return computeGridGeometry(*toStructureOfArrays(gridData), numberOfThreads);
+}
+
+#endif
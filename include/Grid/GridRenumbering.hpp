@@ -0,0 +1,265 @@
+#ifndef GRID_GRID_RENUMBERING_HPP
+#define GRID_GRID_RENUMBERING_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <Grid/GridData.hpp>
+#include <Grid/VertexElementAdjacency.hpp>
+#include <Utilities/Parallel.hpp>
+
+enum class SpaceFillingCurve {hilbert, morton};
+
+// Interleaves the bits of the three coordinates, most significant first, the Hilbert key transposes them first as in Skilling's algorithm
+inline std::uint64_t spaceFillingCurveKey(std::array<std::uint32_t, 3> point, SpaceFillingCurve curve, int numberOfBits = 21) {
+    if (curve == SpaceFillingCurve::hilbert) {
+        std::uint32_t highest = 1u << (numberOfBits - 1);
+        for (std::uint32_t bit = highest; bit > 1; bit >>= 1)
+            for (int axis = 0; axis < 3; axis++)
+                if (point[axis] & bit)
+                    point[0] ^= bit - 1;
+                else {
+                    std::uint32_t swap = (point[0] ^ point[axis]) & (bit - 1);
+                    point[0] ^= swap;
+                    point[axis] ^= swap;
+                }
+
+        for (int axis = 1; axis < 3; axis++)
+            point[axis] ^= point[axis - 1];
+        std::uint32_t gray = 0;
+        for (std::uint32_t bit = highest; bit > 1; bit >>= 1)
+            if (point[2] & bit)
+                gray ^= bit - 1;
+        for (int axis = 0; axis < 3; axis++)
+            point[axis] ^= gray;
+    }
+
+    std::uint64_t key = 0;
+    for (int bit = numberOfBits - 1; bit >= 0; bit--)
+        for (int axis = 0; axis < 3; axis++)
+            key = (key << 1) | ((point[axis] >> bit) & 1u);
+    return key;
+}
+
+// Reverse Cuthill-McKee over the graph of vertices sharing a volume element, every component starts at its unvisited vertex of lowest degree.
+// Returns the new index of every vertex, vertices outside the volume elements keep their relative order after the others.
+inline std::vector<GridIndex> reverseCuthillMcKee(GridData& gridData, int numberOfThreads = defaultNumberOfThreads()) {
+    if (gridData.dimension != 3)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - gridData dimension must be 3 and not " + std::to_string(gridData.dimension));
+
+    const VertexElementAdjacency& adjacency = getVertexElementAdjacency(gridData);
+    GridIndex numberOfVertices = gridData.coordinates.size();
+
+    auto findNeighbours = [&](GridIndex vertex, std::vector<GridIndex>& neighbours) {
+        neighbours.clear();
+        auto add = [&](const auto& element) {
+            for (auto neighbour = element.cbegin(); neighbour != element.cend() - 1; neighbour++)
+                if (*neighbour != vertex)
+                    neighbours.push_back(*neighbour);
+        };
+        for (auto element = adjacency.begin(vertex); element != adjacency.end(vertex); element++)
+            if (*element < adjacency.hexahedronBegin)
+                add(gridData.tetrahedronConnectivity[*element]);
+            else if (*element < adjacency.prismBegin)
+                add(gridData.hexahedronConnectivity[*element - adjacency.hexahedronBegin]);
+            else if (*element < adjacency.pyramidBegin)
+                add(gridData.prismConnectivity[*element - adjacency.prismBegin]);
+            else
+                add(gridData.pyramidConnectivity[*element - adjacency.pyramidBegin]);
+        std::sort(neighbours.begin(), neighbours.end());
+        neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+    };
+
+    std::vector<GridIndex> degrees(numberOfVertices);
+    int numberOfChunks = std::max(GridIndex(1), std::min(GridIndex(numberOfThreads) * 4, numberOfVertices));
+    parallelFor(numberOfChunks, numberOfThreads, [&](int chunk) {
+        std::vector<GridIndex> neighbours;
+        for (GridIndex vertex = long(numberOfVertices) * chunk / numberOfChunks; vertex < long(numberOfVertices) * (chunk + 1) / numberOfChunks; vertex++) {
+            findNeighbours(vertex, neighbours);
+            degrees[vertex] = neighbours.size();
+        }
+    });
+    auto lowerDegree = [&](GridIndex a, GridIndex b) {return degrees[a] < degrees[b] || (degrees[a] == degrees[b] && a < b);};
+
+    std::vector<GridIndex> starts;
+    for (GridIndex vertex = 0; vertex < numberOfVertices; vertex++)
+        if (adjacency.begin(vertex) != adjacency.end(vertex))
+            starts.push_back(vertex);
+    std::sort(starts.begin(), starts.end(), lowerDegree);
+
+    std::vector<GridIndex> order;
+    order.reserve(numberOfVertices);
+    std::vector<bool> visited(numberOfVertices, false);
+    std::vector<GridIndex> neighbours;
+    for (GridIndex start : starts) {
+        if (visited[start])
+            continue;
+
+        visited[start] = true;
+        order.push_back(start);
+        for (std::size_t head = order.size() - 1; head < order.size(); head++) {
+            findNeighbours(order[head], neighbours);
+            neighbours.erase(std::remove_if(neighbours.begin(), neighbours.end(), [&](GridIndex neighbour) {return visited[neighbour];}), neighbours.end());
+            std::sort(neighbours.begin(), neighbours.end(), lowerDegree);
+            for (GridIndex neighbour : neighbours) {
+                visited[neighbour] = true;
+                order.push_back(neighbour);
+            }
+        }
+    }
+    std::reverse(order.begin(), order.end());
+
+    for (GridIndex vertex = 0; vertex < numberOfVertices; vertex++)
+        if (!visited[vertex])
+            order.push_back(vertex);
+
+    std::vector<GridIndex> newIndices(numberOfVertices);
+    for (GridIndex index = 0; index < numberOfVertices; index++)
+        newIndices[order[index]] = index;
+    return newIndices;
+}
+
+// Moves every vertex to its new index, remapping connectivities, boundary and well vertices
+inline void renumberVertices(GridData& gridData, const std::vector<GridIndex>& newIndices, int numberOfThreads = defaultNumberOfThreads()) {
+    GridIndex numberOfVertices = gridData.coordinates.size();
+    if (GridIndex(newIndices.size()) != numberOfVertices)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Expected " + std::to_string(numberOfVertices) + " new indices and found " + std::to_string(newIndices.size()));
+
+    std::vector<std::array<double, 3>> coordinates(numberOfVertices);
+    std::vector<bool> placed(numberOfVertices, false);
+    for (GridIndex vertex = 0; vertex < numberOfVertices; vertex++) {
+        if (newIndices[vertex] < 0 || newIndices[vertex] >= numberOfVertices || placed[newIndices[vertex]])
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The new indices are not a permutation of the vertices");
+        placed[newIndices[vertex]] = true;
+        coordinates[newIndices[vertex]] = gridData.coordinates[vertex];
+    }
+    gridData.coordinates = std::move(coordinates);
+
+    forEachConnectivity(gridData, [&](auto& connectivity) {
+        GridIndex size = connectivity.size();
+        int numberOfChunks = std::max(GridIndex(1), std::min(GridIndex(numberOfThreads) * 4, size));
+        parallelFor(numberOfChunks, numberOfThreads, [&](int chunk) {
+            for (GridIndex i = long(size) * chunk / numberOfChunks; i < long(size) * (chunk + 1) / numberOfChunks; i++)
+                for (auto vertex = connectivity[i].begin(); vertex != connectivity[i].end() - 1; vertex++)
+                    *vertex = newIndices[*vertex];
+        });
+    });
+
+    auto remap = [&](std::vector<GridIndex>& vertices) {
+        for (auto& vertex : vertices)
+            vertex = newIndices[vertex];
+        std::sort(vertices.begin(), vertices.end());
+    };
+    for (auto& boundary : gridData.boundaries)
+        remap(boundary.vertices);
+    for (auto& well : gridData.wells)
+        remap(well.vertices);
+
+    gridData.vertexElementAdjacency.reset();
+    gridData.spatialIndex.reset();
+}
+
+// Element order[i] becomes element i, and every connectivity stays sorted by element index
+inline void reorderElements(GridData& gridData, const std::vector<GridIndex>& order) {
+    std::vector<GridIndex> newIndices(order.size());
+    for (GridIndex index = 0; index < GridIndex(order.size()); index++)
+        newIndices[order[index]] = index;
+
+    forEachConnectivity(gridData, [&](auto& connectivity) {
+        for (auto& element : connectivity)
+            element.back() = newIndices[element.back()];
+        std::sort(connectivity.begin(), connectivity.end(), [](const auto& a, const auto& b) {return a.back() < b.back();});
+    });
+
+    gridData.vertexElementAdjacency.reset();
+}
+
+// Orders the elements of every region and the facets of every boundary along a space filling curve through their centroids.
+// Well lines keep their order along the well, and every connectivity stays sorted by element index.
+inline void renumberElements(GridData& gridData, SpaceFillingCurve curve, int numberOfThreads = defaultNumberOfThreads()) {
+    GridIndex numberOfElements = 0;
+    forEachConnectivity(gridData, [&](const auto& connectivity) {numberOfElements += connectivity.size();});
+
+    std::array<double, 3> lower{0.0, 0.0, 0.0}, extent{0.0, 0.0, 0.0};
+    if (!gridData.coordinates.empty()) {
+        lower = gridData.coordinates.front();
+        std::array<double, 3> upper = lower;
+        for (const auto& coordinate : gridData.coordinates)
+            for (int axis = 0; axis < 3; axis++) {
+                lower[axis] = std::min(lower[axis], coordinate[axis]);
+                upper[axis] = std::max(upper[axis], coordinate[axis]);
+            }
+        for (int axis = 0; axis < 3; axis++)
+            extent[axis] = upper[axis] - lower[axis];
+    }
+
+    const double scale = double((1u << 21) - 1);
+    std::vector<std::uint64_t> keys(numberOfElements);
+    forEachConnectivity(gridData, [&](const auto& connectivity) {
+        GridIndex size = connectivity.size();
+        int numberOfChunks = std::max(GridIndex(1), std::min(GridIndex(numberOfThreads) * 4, size));
+        parallelFor(numberOfChunks, numberOfThreads, [&](int chunk) {
+            for (GridIndex i = long(size) * chunk / numberOfChunks; i < long(size) * (chunk + 1) / numberOfChunks; i++) {
+                const auto& element = connectivity[i];
+                if (element.back() < 0 || element.back() >= numberOfElements)
+                    throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Element " + std::to_string(element.back()) + " is out of range");
+
+                std::array<double, 3> centroid{0.0, 0.0, 0.0};
+                for (auto vertex = element.cbegin(); vertex != element.cend() - 1; vertex++)
+                    for (int axis = 0; axis < 3; axis++)
+                        centroid[axis] += gridData.coordinates[*vertex][axis] / (element.size() - 1);
+
+                std::array<std::uint32_t, 3> point;
+                for (int axis = 0; axis < 3; axis++)
+                    point[axis] = extent[axis] > 0.0 ? std::uint32_t(std::min(scale, std::max(0.0, (centroid[axis] - lower[axis]) / extent[axis] * scale))) : 0u;
+                keys[element.back()] = spaceFillingCurveKey(point, curve);
+            }
+        });
+    });
+
+    std::vector<std::pair<GridIndex, GridIndex>> ranges;
+    for (const auto& region : gridData.regions)
+        ranges.emplace_back(region.elementBegin, region.elementEnd);
+    for (const auto& boundary : gridData.boundaries)
+        ranges.emplace_back(boundary.facetBegin, boundary.facetEnd);
+
+    std::vector<GridIndex> order(numberOfElements);
+    std::iota(order.begin(), order.end(), 0);
+    parallelFor(int(ranges.size()), numberOfThreads, [&](int range) {
+        if (ranges[range].first < 0 || ranges[range].first > ranges[range].second || ranges[range].second > numberOfElements)
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Element range " + std::to_string(range) + " is out of range");
+        std::sort(order.begin() + ranges[range].first, order.begin() + ranges[range].second, [&](GridIndex a, GridIndex b) {return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);});
+    });
+
+    reorderElements(gridData, order);
+}
+
+// Stable reorders the elements of every region so that each element type is contiguous, which lets every region be written as one section per type
+inline void groupElementsByType(GridData& gridData) {
+    GridIndex numberOfElements = 0;
+    forEachConnectivity(gridData, [&](const auto& connectivity) {numberOfElements += connectivity.size();});
+
+    std::vector<unsigned char> types(numberOfElements);
+    unsigned char type = 0;
+    forEachConnectivity(gridData, [&](const auto& connectivity) {
+        for (const auto& element : connectivity) {
+            if (element.back() < 0 || element.back() >= numberOfElements)
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Element " + std::to_string(element.back()) + " is out of range");
+            types[element.back()] = type;
+        }
+        type++;
+    });
+
+    std::vector<GridIndex> order(numberOfElements);
+    std::iota(order.begin(), order.end(), 0);
+    for (const auto& region : gridData.regions) {
+        if (region.elementBegin < 0 || region.elementBegin > region.elementEnd || region.elementEnd > numberOfElements)
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Region " + region.name + " is out of range");
+        std::stable_sort(order.begin() + region.elementBegin, order.begin() + region.elementEnd, [&](GridIndex a, GridIndex b) {return types[a] < types[b];});
+    }
+
+    reorderElements(gridData, order);
+}
+
+#endif
@@ -0,0 +1,269 @@
+#ifndef GRID_GRID_SNAPSHOT_HPP
+#define GRID_GRID_SNAPSHOT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <boost/filesystem.hpp>
+#include <BoostInterface/Iostreams.hpp>
+#include <BoostInterface/PropertyTree.hpp>
+#include <Grid/GridData.hpp>
+#include <Utilities/Hash.hpp>
+#include <Utilities/Parallel.hpp>
+
+// A snapshot is this header followed by flat arrays that start at multiples of 64 bytes, in the order of GridSnapshotArray.
+// Reading one back is a memory map and a copy per array, so it costs no parsing.
+struct GridSnapshotHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t readerVersion;
+    std::uint32_t indexSize;
+    std::uint64_t sourceHash;
+    std::int32_t dimension;
+    std::uint32_t numberOfRegions;
+    std::uint32_t numberOfBoundaries;
+    std::uint32_t numberOfWells;
+    std::uint64_t offsets[11];
+    std::uint64_t sizes[11];
+};
+
+// Regions, boundaries and wells in this order, the names and the vertices are ranges of the names and vertices arrays
+struct GridSnapshotEntity {
+    std::int64_t begin;
+    std::int64_t end;
+    std::uint64_t nameBegin;
+    std::uint64_t nameEnd;
+    std::uint64_t verticesBegin;
+    std::uint64_t verticesEnd;
+};
+
+enum GridSnapshotArray {
+    coordinatesArray, lineArray, triangleArray, quadrangleArray, tetrahedronArray, hexahedronArray, prismArray, pyramidArray, entitiesArray, namesArray, verticesArray
+};
+
+const std::uint32_t gridSnapshotVersion = 2;
+
+// Bump whenever a reader builds different grid data from the same file, so the snapshots of the older readers are not loaded
+const std::uint32_t gridReaderVersion = 1;
+const std::uint64_t gridSnapshotAlignment = 64;
+
+// The file is hashed in chunks of fixed size that are combined in order, so the hash does not depend on the number of threads
+inline std::uint64_t hashFile(const std::string& filePath, int numberOfThreads = defaultNumberOfThreads()) {
+    if (!boost::filesystem::exists(filePath))
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - There is no file " + filePath);
+
+    std::uint64_t fileSize = boost::filesystem::file_size(filePath);
+    if (fileSize == 0)
+        return hashBytes(nullptr, nullptr);
+
+    boost::iostreams::mapped_file_source file(filePath);
+    const std::uint64_t chunkSize = 1 << 20;
+    std::vector<std::uint64_t> chunkHashes((fileSize + chunkSize - 1) / chunkSize);
+    parallelFor(chunkHashes.size(), numberOfThreads, [&](int chunk) {
+        const char* begin = file.data() + chunk * chunkSize;
+        chunkHashes[chunk] = hashBytes(begin, begin + std::min(chunkSize, fileSize - chunk * chunkSize));
+    });
+
+    const char* hashes = reinterpret_cast<const char*>(chunkHashes.data());
+    return hashBytes(hashes, hashes + chunkHashes.size() * sizeof(std::uint64_t), fileSize);
+}
+
+inline void writeGridSnapshot(const GridData& gridData, std::uint64_t sourceHash, const std::string& filePath) {
+    std::vector<GridSnapshotEntity> entities;
+    std::string names;
+    std::vector<GridIndex> vertices;
+    auto addEntity = [&](const std::string& name, GridIndex begin, GridIndex end, const std::vector<GridIndex>& entityVertices) {
+        entities.push_back(GridSnapshotEntity{begin, end, names.size(), names.size() + name.size(), vertices.size(), vertices.size() + entityVertices.size()});
+        names.append(name);
+        vertices.insert(vertices.end(), entityVertices.cbegin(), entityVertices.cend());
+    };
+    for (const auto& region : gridData.regions)
+        addEntity(region.name, region.elementBegin, region.elementEnd, std::vector<GridIndex>());
+    for (const auto& boundary : gridData.boundaries)
+        addEntity(boundary.name, boundary.facetBegin, boundary.facetEnd, boundary.vertices);
+    for (const auto& well : gridData.wells)
+        addEntity(well.name, well.lineBegin, well.lineEnd, well.vertices);
+
+    const std::vector<std::pair<const void*, std::uint64_t>> arrays{
+        {gridData.coordinates.data(), gridData.coordinates.size() * sizeof(gridData.coordinates[0])},
+        {gridData.lineConnectivity.data(), gridData.lineConnectivity.size() * sizeof(gridData.lineConnectivity[0])},
+        {gridData.triangleConnectivity.data(), gridData.triangleConnectivity.size() * sizeof(gridData.triangleConnectivity[0])},
+        {gridData.quadrangleConnectivity.data(), gridData.quadrangleConnectivity.size() * sizeof(gridData.quadrangleConnectivity[0])},
+        {gridData.tetrahedronConnectivity.data(), gridData.tetrahedronConnectivity.size() * sizeof(gridData.tetrahedronConnectivity[0])},
+        {gridData.hexahedronConnectivity.data(), gridData.hexahedronConnectivity.size() * sizeof(gridData.hexahedronConnectivity[0])},
+        {gridData.prismConnectivity.data(), gridData.prismConnectivity.size() * sizeof(gridData.prismConnectivity[0])},
+        {gridData.pyramidConnectivity.data(), gridData.pyramidConnectivity.size() * sizeof(gridData.pyramidConnectivity[0])},
+        {entities.data(), entities.size() * sizeof(GridSnapshotEntity)},
+        {names.data(), names.size()},
+        {vertices.data(), vertices.size() * sizeof(GridIndex)}
+    };
+
+    GridSnapshotHeader header{};
+    std::memcpy(header.magic, "GRIDSNAP", 8);
+    header.version = gridSnapshotVersion;
+    header.readerVersion = gridReaderVersion;
+    header.indexSize = sizeof(GridIndex);
+    header.sourceHash = sourceHash;
+    header.dimension = gridData.dimension;
+    header.numberOfRegions = gridData.regions.size();
+    header.numberOfBoundaries = gridData.boundaries.size();
+    header.numberOfWells = gridData.wells.size();
+
+    std::uint64_t offset = sizeof(GridSnapshotHeader);
+    for (unsigned i = 0; i < arrays.size(); i++) {
+        offset = (offset + gridSnapshotAlignment - 1) / gridSnapshotAlignment * gridSnapshotAlignment;
+        header.offsets[i] = offset;
+        header.sizes[i] = arrays[i].second;
+        offset += arrays[i].second;
+    }
+
+    // Concurrent runs never see a partial snapshot, it only appears under its name once it is complete
+    std::string temporaryPath = filePath + boost::filesystem::unique_path(".%%%%%%%%").string();
+    {
+        std::ofstream file(temporaryPath, std::ios::binary);
+        if (!file)
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not create " + temporaryPath);
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(GridSnapshotHeader));
+        const std::string padding(gridSnapshotAlignment, '\0');
+        std::uint64_t position = sizeof(GridSnapshotHeader);
+        for (unsigned i = 0; i < arrays.size(); i++) {
+            file.write(padding.data(), header.offsets[i] - position);
+            file.write(static_cast<const char*>(arrays[i].first), arrays[i].second);
+            position = header.offsets[i] + arrays[i].second;
+        }
+
+        if (!file) {
+            file.close();
+            boost::filesystem::remove(temporaryPath);
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not write " + temporaryPath);
+        }
+    }
+    boost::filesystem::rename(temporaryPath, filePath);
+}
+
+template<class T>
+void readGridSnapshotArray(const boost::iostreams::mapped_file_source& file, const GridSnapshotHeader& header, GridSnapshotArray array, std::vector<T>& values) {
+    if (header.sizes[array] % sizeof(T) != 0)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Snapshot array " + std::to_string(array) + " size is not a multiple of its element size");
+
+    values.resize(header.sizes[array] / sizeof(T));
+    if (!values.empty())
+        std::memcpy(static_cast<void*>(values.data()), file.data() + header.offsets[array], header.sizes[array]);
+}
+
+inline boost::shared_ptr<GridData> readGridSnapshot(const std::string& filePath, std::uint64_t sourceHash) {
+    boost::iostreams::mapped_file_source file(filePath);
+    if (file.size() < sizeof(GridSnapshotHeader))
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - " + filePath + " is too short to be a grid snapshot");
+
+    GridSnapshotHeader header;
+    std::memcpy(&header, file.data(), sizeof(GridSnapshotHeader));
+    if (std::memcmp(header.magic, "GRIDSNAP", 8) != 0)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - " + filePath + " is not a grid snapshot");
+
+    if (header.version != gridSnapshotVersion)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Snapshot version " + std::to_string(header.version) + " is not " + std::to_string(gridSnapshotVersion));
+
+    if (header.readerVersion != gridReaderVersion)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Snapshot reader version " + std::to_string(header.readerVersion) + " is not " + std::to_string(gridReaderVersion));
+
+    if (header.indexSize != sizeof(GridIndex))
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Snapshot indices have " + std::to_string(header.indexSize) + " bytes and not " + std::to_string(sizeof(GridIndex)));
+
+    if (header.sourceHash != sourceHash)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Snapshot was taken from a different source");
+
+    for (int i = coordinatesArray; i <= verticesArray; i++)
+        if (header.offsets[i] > file.size() || header.sizes[i] > file.size() - header.offsets[i])
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Snapshot array " + std::to_string(i) + " is out of the file");
+
+    auto gridData = boost::make_shared<GridData>();
+    gridData->dimension = header.dimension;
+    readGridSnapshotArray(file, header, coordinatesArray, gridData->coordinates);
+    readGridSnapshotArray(file, header, lineArray, gridData->lineConnectivity);
+    readGridSnapshotArray(file, header, triangleArray, gridData->triangleConnectivity);
+    readGridSnapshotArray(file, header, quadrangleArray, gridData->quadrangleConnectivity);
+    readGridSnapshotArray(file, header, tetrahedronArray, gridData->tetrahedronConnectivity);
+    readGridSnapshotArray(file, header, hexahedronArray, gridData->hexahedronConnectivity);
+    readGridSnapshotArray(file, header, prismArray, gridData->prismConnectivity);
+    readGridSnapshotArray(file, header, pyramidArray, gridData->pyramidConnectivity);
+
+    std::vector<GridSnapshotEntity> entities;
+    std::vector<GridIndex> vertices;
+    readGridSnapshotArray(file, header, entitiesArray, entities);
+    readGridSnapshotArray(file, header, verticesArray, vertices);
+    const char* names = file.data() + header.offsets[namesArray];
+
+    if (entities.size() != std::uint64_t(header.numberOfRegions) + header.numberOfBoundaries + header.numberOfWells)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Snapshot has " + std::to_string(entities.size()) + " regions, boundaries and wells");
+
+    for (unsigned i = 0; i < entities.size(); i++) {
+        const GridSnapshotEntity& entity = entities[i];
+        if (entity.nameBegin > entity.nameEnd || entity.nameEnd > header.sizes[namesArray] || entity.verticesBegin > entity.verticesEnd || entity.verticesEnd > vertices.size())
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Snapshot entity " + std::to_string(i) + " is out of the file");
+
+        std::string name(names + entity.nameBegin, names + entity.nameEnd);
+        std::vector<GridIndex> entityVertices(vertices.cbegin() + entity.verticesBegin, vertices.cbegin() + entity.verticesEnd);
+        if (i < header.numberOfRegions)
+            gridData->regions.emplace_back(RegionData{name, GridIndex(entity.begin), GridIndex(entity.end)});
+        else if (i < header.numberOfRegions + header.numberOfBoundaries)
+            gridData->boundaries.emplace_back(BoundaryData{name, GridIndex(entity.begin), GridIndex(entity.end), std::move(entityVertices)});
+        else
+            gridData->wells.emplace_back(WellData{name, GridIndex(entity.begin), GridIndex(entity.end), std::move(entityVertices)});
+    }
+
+    return gridData;
+}
+
+inline std::string defaultSnapshotDirectory() {
+    return (boost::filesystem::temp_directory_path() / "MSHtoCGNS").string();
+}
+
+inline std::string gridSnapshotName(std::uint64_t sourceHash, const std::string& readerName) {
+    std::stringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << sourceHash << "-" << readerName << "-v" << std::dec << gridSnapshotVersion << "." << gridReaderVersion << "-" << 8 * sizeof(GridIndex) << ".snapshot";
+    return name.str();
+}
+
+// The snapshot is keyed by the source content, the reader and the snapshot and reader versions, since different readers build different grid data from the same file.
+// read is only called when there is no usable snapshot, and a corrupt or outdated snapshot is replaced by a new one.
+// The cache is best effort: when the snapshot cannot be written the grid data that was just read is still returned.
+template<class Read>
+boost::shared_ptr<GridData> readThroughSnapshot(const std::string& sourcePath, const std::string& readerName, const std::string& snapshotDirectory, Read&& read) {
+    std::uint64_t sourceHash = hashFile(sourcePath);
+    std::string snapshotPath = (boost::filesystem::path(snapshotDirectory) / gridSnapshotName(sourceHash, readerName)).string();
+    if (boost::filesystem::exists(snapshotPath)) {
+        try {
+            return readGridSnapshot(snapshotPath, sourceHash);
+        }
+        catch (const std::exception&) {}
+    }
+
+    boost::shared_ptr<GridData> gridData = read();
+    try {
+        boost::filesystem::create_directories(snapshotDirectory);
+        writeGridSnapshot(*gridData, sourceHash, snapshotPath);
+    }
+    catch (const std::exception& exception) {
+        std::cerr << std::endl << "\tCould not write the grid snapshot " << snapshotPath << ": " << exception.what() << std::endl;
+    }
+    return gridData;
+}
+
+// The cache keeps a full copy of every grid it reads, so scripts turn it on with cache.enabled and move it with cache.directory
+template<class Read>
+boost::shared_ptr<GridData> readThroughSnapshot(const boost::property_tree::ptree& script, const std::string& sourcePath, const std::string& readerName, Read&& read) {
+    if (!script.get<bool>("cache.enabled", false))
+        return read();
+
+    return readThroughSnapshot(sourcePath, readerName, script.get<std::string>("cache.directory", defaultSnapshotDirectory()), read);
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef GRID_GRID_STREAM_HPP
+#define GRID_GRID_STREAM_HPP
+
+#include <array>
+#include <functional>
+#include <vector>
+#include <Grid/GridData.hpp>
+
+struct CoordinateChunk {
+    GridIndex begin;
+    std::vector<std::array<double, 3>> coordinates;
+};
+
+// Sections are the regions followed by the boundaries of the grid data
+struct ConnectivityChunk {
+    int section;
+    GridIndex begin;
+    std::vector<int> sizes;
+    std::vector<GridIndex> vertices;
+};
+
+// A grid source that describes its layout up front and then hands out its coordinates and connectivities in bounded chunks.
+// The grid data holds the dimension, the region and boundary ranges and the boundary vertices, but no coordinates or connectivities.
+class GridStream {
+    public:
+        virtual ~GridStream() = default;
+
+        virtual boost::shared_ptr<GridData> getGridData() const = 0;
+        virtual GridIndex getNumberOfVertices() const = 0;
+        // Number of vertices of every element in the section, or 0 if the section mixes element types
+        virtual int getSectionElementSize(int section) const = 0;
+        virtual void streamCoordinates(const std::function<void(const CoordinateChunk&)>& write) = 0;
+        virtual void streamConnectivities(const std::function<void(const ConnectivityChunk&)>& write) = 0;
+};
+
+#endif
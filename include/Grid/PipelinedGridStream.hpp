@@ -0,0 +1,97 @@
+#ifndef GRID_PIPELINED_GRID_STREAM_HPP
+#define GRID_PIPELINED_GRID_STREAM_HPP
+
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <Grid/GridStream.hpp>
+#include <Utilities/BoundedQueue.hpp>
+
+// Parses another grid stream on its own thread: the coordinates and then the connectivities go through bounded queues,
+// so the elements are parsed while the coordinates are written and every chunk is parsed while the one before it is written.
+// Like the streams it wraps, it hands out the coordinates once and then the connectivities once.
+class PipelinedGridStream : public GridStream {
+    public:
+        PipelinedGridStream(boost::shared_ptr<GridStream> gridStream, std::size_t capacity = 4) : gridStream(gridStream), coordinateChunks(capacity), connectivityChunks(capacity) {}
+
+        ~PipelinedGridStream() {
+            this->coordinateChunks.close();
+            this->connectivityChunks.close();
+            if (this->producer.joinable())
+                this->producer.join();
+        }
+
+        boost::shared_ptr<GridData> getGridData() const override {
+            return this->gridStream->getGridData();
+        }
+
+        GridIndex getNumberOfVertices() const override {
+            return this->gridStream->getNumberOfVertices();
+        }
+
+        int getSectionElementSize(int section) const override {
+            return this->gridStream->getSectionElementSize(section);
+        }
+
+        void streamCoordinates(const std::function<void(const CoordinateChunk&)>& write) override {
+            this->start();
+            CoordinateChunk chunk;
+            while (this->coordinateChunks.pop(chunk))
+                write(chunk);
+            if (this->coordinateException)
+                std::rethrow_exception(this->coordinateException);
+        }
+
+        void streamConnectivities(const std::function<void(const ConnectivityChunk&)>& write) override {
+            this->start();
+            ConnectivityChunk chunk;
+            while (this->connectivityChunks.pop(chunk))
+                write(chunk);
+            this->producer.join();
+            for (auto exception : {this->coordinateException, this->connectivityException})
+                if (exception)
+                    std::rethrow_exception(exception);
+        }
+
+    private:
+        // A closed queue means the consumer gave up, and the parsing stops at the next chunk
+        template<class T>
+        static void push(BoundedQueue<T>& queue, const T& chunk) {
+            if (!queue.push(chunk))
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The grid stream was closed");
+        }
+
+        void start() {
+            if (this->started)
+                return;
+            this->started = true;
+            this->producer = std::thread([this]() {
+                try {
+                    this->gridStream->streamCoordinates([this](const CoordinateChunk& chunk) {push(this->coordinateChunks, chunk);});
+                }
+                catch (...) {
+                    this->coordinateException = std::current_exception();
+                }
+                this->coordinateChunks.close();
+
+                try {
+                    if (!this->coordinateException)
+                        this->gridStream->streamConnectivities([this](const ConnectivityChunk& chunk) {push(this->connectivityChunks, chunk);});
+                }
+                catch (...) {
+                    this->connectivityException = std::current_exception();
+                }
+                this->connectivityChunks.close();
+            });
+        }
+
+        boost::shared_ptr<GridStream> gridStream;
+        BoundedQueue<CoordinateChunk> coordinateChunks;
+        BoundedQueue<ConnectivityChunk> connectivityChunks;
+        bool started = false;
+        std::exception_ptr coordinateException, connectivityException;
+        std::thread producer;
+};
+
+#endif
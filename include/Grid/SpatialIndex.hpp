@@ -0,0 +1,222 @@
+#ifndef GRID_SPATIAL_INDEX_HPP
+#define GRID_SPATIAL_INDEX_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <Grid/GridData.hpp>
+#include <Utilities/Hash.hpp>
+#include <Utilities/Parallel.hpp>
+
+// Vertices binned in a uniform grid of cells over their bounding box, about one vertex per cell.
+// The vertices of cell c are vertices[offsets[c], offsets[c+1]) in increasing order, with their coordinates copied alongside.
+struct SpatialIndex {
+    std::array<double, 3> lower;
+    std::array<double, 3> cellSize;
+    std::array<GridIndex, 3> numberOfCells;
+
+    std::vector<GridIndex> offsets;
+    std::vector<GridIndex> vertices;
+    std::vector<std::array<double, 3>> coordinates;
+    std::uint64_t coordinatesHash;
+
+    GridIndex cellOf(int axis, double value) const {
+        double cell = std::floor((value - this->lower[axis]) / this->cellSize[axis]);
+        return GridIndex(std::max(0.0, std::min(cell, double(this->numberOfCells[axis] - 1))));
+    }
+
+    GridIndex cellIndex(GridIndex i, GridIndex j, GridIndex k) const {
+        return i + this->numberOfCells[0] * (j + this->numberOfCells[1] * k);
+    }
+
+    // Calls function(vertex, coordinate) for every vertex inside the closed box [lower, upper], cell by cell
+    template<class Function>
+    void forEachInBox(const std::array<double, 3>& lower, const std::array<double, 3>& upper, Function&& function) const {
+        if (this->vertices.empty())
+            return;
+
+        std::array<GridIndex, 3> begin, end;
+        for (int axis = 0; axis < 3; axis++) {
+            begin[axis] = this->cellOf(axis, lower[axis]);
+            end[axis] = this->cellOf(axis, upper[axis]) + 1;
+        }
+
+        for (GridIndex k = begin[2]; k < end[2]; k++)
+            for (GridIndex j = begin[1]; j < end[1]; j++)
+                for (GridIndex i = begin[0]; i < end[0]; i++) {
+                    GridIndex cell = this->cellIndex(i, j, k);
+                    for (GridIndex position = this->offsets[cell]; position < this->offsets[cell + 1]; position++) {
+                        const auto& coordinate = this->coordinates[position];
+                        if (coordinate[0] >= lower[0] && coordinate[0] <= upper[0] && coordinate[1] >= lower[1] && coordinate[1] <= upper[1] && coordinate[2] >= lower[2] && coordinate[2] <= upper[2])
+                            function(this->vertices[position], coordinate);
+                    }
+                }
+    }
+
+    std::vector<GridIndex> findInBox(const std::array<double, 3>& lower, const std::array<double, 3>& upper) const {
+        std::vector<GridIndex> found;
+        this->forEachInBox(lower, upper, [&](GridIndex vertex, const std::array<double, 3>&) {found.push_back(vertex);});
+        std::sort(found.begin(), found.end());
+        return found;
+    }
+
+    std::vector<GridIndex> findWithinRadius(const std::array<double, 3>& point, double radius) const {
+        std::vector<GridIndex> found;
+        this->forEachInBox({point[0] - radius, point[1] - radius, point[2] - radius}, {point[0] + radius, point[1] + radius, point[2] + radius}, [&](GridIndex vertex, const std::array<double, 3>& coordinate) {
+            if (squaredDistance(point, coordinate) <= radius * radius)
+                found.push_back(vertex);
+        });
+        std::sort(found.begin(), found.end());
+        return found;
+    }
+
+    // Vertices within tolerance of the line through point parallel to the axis, on both of the other coordinates
+    std::vector<GridIndex> findOnLine(const std::array<double, 3>& point, int axis, double tolerance) const {
+        std::array<double, 3> lower, upper;
+        for (int i = 0; i < 3; i++) {
+            lower[i] = i == axis ? -std::numeric_limits<double>::infinity() : point[i] - tolerance;
+            upper[i] = i == axis ? std::numeric_limits<double>::infinity() : point[i] + tolerance;
+        }
+        return this->findInBox(lower, upper);
+    }
+
+    // Searches rings of cells around the point until no closer vertex can lie outside them, the smaller index wins a tie
+    GridIndex findNearest(const std::array<double, 3>& point) const {
+        if (this->vertices.empty())
+            return -1;
+
+        std::array<GridIndex, 3> center{this->cellOf(0, point[0]), this->cellOf(1, point[1]), this->cellOf(2, point[2])};
+        double minimumCellSize = std::min({this->cellSize[0], this->cellSize[1], this->cellSize[2]});
+        GridIndex maximumRing = std::max({this->numberOfCells[0], this->numberOfCells[1], this->numberOfCells[2]});
+
+        GridIndex nearest = -1;
+        double nearestDistance = std::numeric_limits<double>::max();
+        for (GridIndex ring = 0; ring <= maximumRing; ring++) {
+            if (nearest != -1 && std::sqrt(nearestDistance) <= (ring - 1) * minimumCellSize)
+                break;
+
+            std::array<GridIndex, 3> begin, end;
+            for (int axis = 0; axis < 3; axis++) {
+                begin[axis] = std::max(GridIndex(0), center[axis] - ring);
+                end[axis] = std::min(this->numberOfCells[axis], center[axis] + ring + 1);
+            }
+
+            for (GridIndex k = begin[2]; k < end[2]; k++)
+                for (GridIndex j = begin[1]; j < end[1]; j++)
+                    for (GridIndex i = begin[0]; i < end[0]; i++) {
+                        if (std::abs(i - center[0]) != ring && std::abs(j - center[1]) != ring && std::abs(k - center[2]) != ring)
+                            continue;
+
+                        GridIndex cell = this->cellIndex(i, j, k);
+                        for (GridIndex position = this->offsets[cell]; position < this->offsets[cell + 1]; position++) {
+                            double distance = squaredDistance(point, this->coordinates[position]);
+                            if (distance < nearestDistance || (distance == nearestDistance && this->vertices[position] < nearest)) {
+                                nearest = this->vertices[position];
+                                nearestDistance = distance;
+                            }
+                        }
+                    }
+        }
+        return nearest;
+    }
+
+    std::size_t size() const {
+        return this->vertices.size();
+    }
+
+    // Moving, adding or removing vertices changes the hash of the coordinates, so a stale index never matches
+    bool matches(const GridData& gridData) const {
+        return this->vertices.size() == gridData.coordinates.size() && this->coordinatesHash == hashCoordinates(gridData.coordinates);
+    }
+
+    static std::uint64_t hashCoordinates(const std::vector<std::array<double, 3>>& coordinates) {
+        const char* bytes = reinterpret_cast<const char*>(coordinates.data());
+        return hashBytes(bytes, bytes + coordinates.size() * sizeof(coordinates[0]));
+    }
+
+    static double squaredDistance(const std::array<double, 3>& a, const std::array<double, 3>& b) {
+        return (a[0] - b[0]) * (a[0] - b[0]) + (a[1] - b[1]) * (a[1] - b[1]) + (a[2] - b[2]) * (a[2] - b[2]);
+    }
+};
+
+// Counts the vertices of every cell first, so a prefix sum places every cell before the vertices are filled in
+inline boost::shared_ptr<const SpatialIndex> buildSpatialIndex(const std::vector<std::array<double, 3>>& coordinates, int numberOfThreads = defaultNumberOfThreads()) {
+    auto index = boost::make_shared<SpatialIndex>();
+    GridIndex numberOfVertices = coordinates.size();
+    index->coordinatesHash = SpatialIndex::hashCoordinates(coordinates);
+
+    std::array<double, 3> upper;
+    index->lower.fill(numberOfVertices ? std::numeric_limits<double>::max() : 0.0);
+    upper.fill(numberOfVertices ? std::numeric_limits<double>::lowest() : 0.0);
+    for (const auto& coordinate : coordinates)
+        for (int axis = 0; axis < 3; axis++) {
+            index->lower[axis] = std::min(index->lower[axis], coordinate[axis]);
+            upper[axis] = std::max(upper[axis], coordinate[axis]);
+        }
+
+    // Cells are cubes filling the box over its non flat axes, so flat grids still get about one vertex per cell
+    double volume = 1.0;
+    int numberOfAxes = 0;
+    for (int axis = 0; axis < 3; axis++)
+        if (upper[axis] > index->lower[axis]) {
+            volume *= upper[axis] - index->lower[axis];
+            numberOfAxes++;
+        }
+    double size = numberOfAxes ? std::pow(volume / std::max(GridIndex(1), numberOfVertices), 1.0 / numberOfAxes) : 1.0;
+    for (int axis = 0; axis < 3; axis++) {
+        double extent = upper[axis] - index->lower[axis];
+        index->numberOfCells[axis] = extent > 0.0 ? std::max(GridIndex(1), std::min(GridIndex(std::ceil(extent / size)), std::max(GridIndex(1), numberOfVertices))) : 1;
+        index->cellSize[axis] = extent > 0.0 ? extent / index->numberOfCells[axis] : 1.0;
+    }
+    GridIndex numberOfCells = index->numberOfCells[0] * index->numberOfCells[1] * index->numberOfCells[2];
+
+    int numberOfChunks = std::max(GridIndex(1), std::min(GridIndex(numberOfThreads) * 4, numberOfVertices));
+    auto forEach = [&](auto&& function) {
+        parallelFor(numberOfChunks, numberOfThreads, [&](int chunk) {
+            for (GridIndex vertex = long(numberOfVertices) * chunk / numberOfChunks; vertex < long(numberOfVertices) * (chunk + 1) / numberOfChunks; vertex++) {
+                const auto& coordinate = coordinates[vertex];
+                function(vertex, index->cellIndex(index->cellOf(0, coordinate[0]), index->cellOf(1, coordinate[1]), index->cellOf(2, coordinate[2])));
+            }
+        });
+    };
+
+    std::vector<std::atomic<GridIndex>> positions(numberOfCells);
+    forEach([&](GridIndex, GridIndex cell) {
+        positions[cell].fetch_add(1, std::memory_order_relaxed);
+    });
+
+    index->offsets.resize(numberOfCells + 1);
+    index->offsets[0] = 0;
+    for (GridIndex cell = 0; cell < numberOfCells; cell++) {
+        index->offsets[cell + 1] = index->offsets[cell] + positions[cell].load(std::memory_order_relaxed);
+        positions[cell].store(index->offsets[cell], std::memory_order_relaxed);
+    }
+
+    index->vertices.resize(numberOfVertices);
+    forEach([&](GridIndex vertex, GridIndex cell) {
+        index->vertices[positions[cell].fetch_add(1, std::memory_order_relaxed)] = vertex;
+    });
+
+    index->coordinates.resize(numberOfVertices);
+    int numberOfCellChunks = std::max(GridIndex(1), std::min(GridIndex(numberOfThreads) * 4, numberOfCells));
+    parallelFor(numberOfCellChunks, numberOfThreads, [&](int chunk) {
+        for (GridIndex cell = long(numberOfCells) * chunk / numberOfCellChunks; cell < long(numberOfCells) * (chunk + 1) / numberOfCellChunks; cell++) {
+            std::sort(index->vertices.begin() + index->offsets[cell], index->vertices.begin() + index->offsets[cell + 1]);
+            for (GridIndex position = index->offsets[cell]; position < index->offsets[cell + 1]; position++)
+                index->coordinates[position] = coordinates[index->vertices[position]];
+        }
+    });
+
+    return index;
+}
+
+// Built on first use and kept on the grid data until its vertices change
+inline const SpatialIndex& getSpatialIndex(GridData& gridData) {
+    if (!gridData.spatialIndex || !gridData.spatialIndex->matches(gridData))
+        gridData.spatialIndex = buildSpatialIndex(gridData.coordinates);
+    return *gridData.spatialIndex;
+}
+
+#endif
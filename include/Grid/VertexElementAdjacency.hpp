@@ -0,0 +1,100 @@
+#ifndef GRID_VERTEX_ELEMENT_ADJACENCY_HPP
+#define GRID_VERTEX_ELEMENT_ADJACENCY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <Grid/GridData.hpp>
+#include <Utilities/Parallel.hpp>
+
+// Volume elements touching every vertex in compressed rows: the elements of vertex v are elements[offsets[v], offsets[v+1]), in increasing order.
+// Elements are numbered in storage order, tetrahedra from 0, then hexahedra from hexahedronBegin, prisms from prismBegin and pyramids from pyramidBegin.
+struct VertexElementAdjacency {
+    std::vector<GridIndex> offsets;
+    std::vector<GridIndex> elements;
+
+    GridIndex hexahedronBegin;
+    GridIndex prismBegin;
+    GridIndex pyramidBegin;
+    GridIndex numberOfElements;
+
+    const GridIndex* begin(GridIndex vertex) const {
+        return this->elements.data() + this->offsets[vertex];
+    }
+
+    const GridIndex* end(GridIndex vertex) const {
+        return this->elements.data() + this->offsets[vertex + 1];
+    }
+
+    bool matches(const GridData& gridData) const {
+        return GridIndex(this->offsets.size()) == GridIndex(gridData.coordinates.size()) + 1 &&
+               this->hexahedronBegin == GridIndex(gridData.tetrahedronConnectivity.size()) &&
+               this->prismBegin == this->hexahedronBegin + GridIndex(gridData.hexahedronConnectivity.size()) &&
+               this->pyramidBegin == this->prismBegin + GridIndex(gridData.prismConnectivity.size()) &&
+               this->numberOfElements == this->pyramidBegin + GridIndex(gridData.pyramidConnectivity.size());
+    }
+};
+
+template<class Connectivity, class Function>
+void forEachElementVertex(const Connectivity& connectivity, GridIndex shift, int numberOfThreads, Function&& function) {
+    GridIndex size = connectivity.size();
+    int numberOfChunks = std::max(GridIndex(1), std::min(GridIndex(numberOfThreads) * 4, size));
+    parallelFor(numberOfChunks, numberOfThreads, [&](int chunk) {
+        for (GridIndex i = long(size) * chunk / numberOfChunks; i < long(size) * (chunk + 1) / numberOfChunks; i++)
+            for (auto vertex = connectivity[i].cbegin(); vertex != connectivity[i].cend() - 1; vertex++)
+                function(*vertex, shift + i);
+    });
+}
+
+// Counts the elements of every vertex first, so a prefix sum places every row before the elements are filled in
+inline boost::shared_ptr<const VertexElementAdjacency> buildVertexElementAdjacency(const GridData& gridData, int numberOfThreads = defaultNumberOfThreads()) {
+    auto adjacency = boost::make_shared<VertexElementAdjacency>();
+    adjacency->hexahedronBegin = gridData.tetrahedronConnectivity.size();
+    adjacency->prismBegin = adjacency->hexahedronBegin + gridData.hexahedronConnectivity.size();
+    adjacency->pyramidBegin = adjacency->prismBegin + gridData.prismConnectivity.size();
+    adjacency->numberOfElements = adjacency->pyramidBegin + gridData.pyramidConnectivity.size();
+
+    GridIndex numberOfVertices = gridData.coordinates.size();
+    auto forEach = [&](auto&& function) {
+        forEachElementVertex(gridData.tetrahedronConnectivity, 0, numberOfThreads, function);
+        forEachElementVertex(gridData.hexahedronConnectivity, adjacency->hexahedronBegin, numberOfThreads, function);
+        forEachElementVertex(gridData.prismConnectivity, adjacency->prismBegin, numberOfThreads, function);
+        forEachElementVertex(gridData.pyramidConnectivity, adjacency->pyramidBegin, numberOfThreads, function);
+    };
+
+    std::vector<std::atomic<GridIndex>> positions(numberOfVertices);
+    forEach([&](GridIndex vertex, GridIndex) {
+        if (vertex < 0 || vertex >= numberOfVertices)
+            throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Vertex " + std::to_string(vertex) + " is out of range");
+        positions[vertex].fetch_add(1, std::memory_order_relaxed);
+    });
+
+    adjacency->offsets.resize(numberOfVertices + 1);
+    adjacency->offsets[0] = 0;
+    for (GridIndex vertex = 0; vertex < numberOfVertices; vertex++) {
+        adjacency->offsets[vertex + 1] = adjacency->offsets[vertex] + positions[vertex].load(std::memory_order_relaxed);
+        positions[vertex].store(adjacency->offsets[vertex], std::memory_order_relaxed);
+    }
+
+    adjacency->elements.resize(adjacency->offsets.back());
+    forEach([&](GridIndex vertex, GridIndex element) {
+        adjacency->elements[positions[vertex].fetch_add(1, std::memory_order_relaxed)] = element;
+    });
+
+    int numberOfChunks = std::max(GridIndex(1), std::min(GridIndex(numberOfThreads) * 4, numberOfVertices));
+    parallelFor(numberOfChunks, numberOfThreads, [&](int chunk) {
+        for (GridIndex vertex = long(numberOfVertices) * chunk / numberOfChunks; vertex < long(numberOfVertices) * (chunk + 1) / numberOfChunks; vertex++)
+            std::sort(adjacency->elements.begin() + adjacency->offsets[vertex], adjacency->elements.begin() + adjacency->offsets[vertex + 1]);
+    });
+
+    return adjacency;
+}
+
+// Built on first use and kept on the grid data until its vertex or volume element counts change
+inline const VertexElementAdjacency& getVertexElementAdjacency(GridData& gridData) {
+    if (!gridData.vertexElementAdjacency || !gridData.vertexElementAdjacency->matches(gridData))
+        gridData.vertexElementAdjacency = buildVertexElementAdjacency(gridData);
+    return *gridData.vertexElementAdjacency;
+}
+
+#endif
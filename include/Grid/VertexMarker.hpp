@@ -0,0 +1,53 @@
+#ifndef GRID_VERTEX_MARKER_HPP
+#define GRID_VERTEX_MARKER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include <Grid/GridData.hpp>
+#include <Utilities/Parallel.hpp>
+
+class VertexMarker {
+    public:
+        VertexMarker(GridIndex numberOfVertices) : marked(numberOfVertices, false) {}
+
+        // The connectivity must be ordered by its last entry, the global element index, as the readers build it
+        template<class Connectivity>
+        void mark(const Connectivity& connectivity, GridIndex begin, GridIndex end) {
+            auto first = std::lower_bound(connectivity.cbegin(), connectivity.cend(), begin, [](const auto& element, GridIndex index) {return element.back() < index;});
+            for (auto element = first; element != connectivity.cend() && element->back() < end; element++) {
+                for (auto vertex = element->cbegin(); vertex != element->cend() - 1; vertex++) {
+                    if (!this->marked[*vertex]) {
+                        this->marked[*vertex] = true;
+                        this->vertices.push_back(*vertex);
+                    }
+                }
+            }
+        }
+
+        std::vector<GridIndex> extract() {
+            std::sort(this->vertices.begin(), this->vertices.end());
+            for (GridIndex vertex : this->vertices)
+                this->marked[vertex] = false;
+            std::vector<GridIndex> extracted;
+            extracted.swap(this->vertices);
+            return extracted;
+        }
+
+    private:
+        std::vector<bool> marked;
+        std::vector<GridIndex> vertices;
+};
+
+// Each thread owns one marker and takes the next group as soon as it finishes the previous one
+template<class Function>
+void markVertices(int numberOfGroups, GridIndex numberOfVertices, int numberOfThreads, Function&& function) {
+    std::atomic<int> nextGroup(0);
+    parallelFor(std::min(numberOfThreads, numberOfGroups), numberOfThreads, [&](int) {
+        VertexMarker marker(numberOfVertices);
+        for (int group = nextGroup++; group < numberOfGroups; group = nextGroup++)
+            function(group, marker);
+    });
+}
+
+#endif
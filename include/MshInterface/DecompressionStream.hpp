@@ -0,0 +1,33 @@
+#ifndef DECOMPRESSION_STREAM_HPP
+#define DECOMPRESSION_STREAM_HPP
+
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <BoostInterface/Filesystem.hpp>
+#include <Utilities/BoundedQueue.hpp>
+
+class DecompressionStream {
+    public:
+        DecompressionStream(std::string filePath, std::size_t chunkSize = 1 << 22, std::size_t capacity = 8);
+
+        ~DecompressionStream();
+
+        bool read(std::string& chunk);
+
+        static bool isCompressed(std::string filePath);
+
+    private:
+        void decompress();
+        void decompressGzip();
+        void decompressZstd();
+
+        std::string filePath;
+        std::size_t chunkSize;
+        BoundedQueue<std::string> chunks;
+        std::exception_ptr exception;
+        std::thread producer;
+};
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef MSH_FORMAT_HPP
+#define MSH_FORMAT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Grid/GridData.hpp>
+#include <Utilities/Parse.hpp>
+
+typedef std::unordered_map<std::string, std::pair<const char*, const char*>> MshSections;
+
+struct MshFormat {
+    double version = 0.0;
+    bool binary = false;
+    int dataSize = 8;
+    bool swapBytes = false;
+};
+
+struct MshBlock {
+    const char* begin;
+    const char* end;
+    GridIndex numberOfRecords;
+    GridIndex firstIndex;
+    int type;
+    int recordSize;
+    const std::vector<int>* physicals;
+};
+
+// Counts and tags are parsed as long, and must fit in the GridIndex of the build
+inline GridIndex toGridIndex(long value) {
+    if (value < 0 || value > long(std::numeric_limits<GridIndex>::max()))
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The value " + std::to_string(value) + " does not fit in the grid indices, build with GRID_64_BIT_INDICES");
+    return GridIndex(value);
+}
+
+inline int numberOfElementNodes(int type) {
+    static const std::vector<int> numbersOfNodes{0, 2, 3, 4, 4, 8, 6, 5, 3, 6, 9, 10, 27, 18, 14, 1, 8, 20, 15, 13, 9, 10, 12, 15, 15, 21, 4, 5, 6, 20, 35, 56};
+    if (type < 1 || type >= int(numbersOfNodes.size()))
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The element type " + std::to_string(type) + " is not supported");
+    return numbersOfNodes[type];
+}
+
+struct MshConnectivities {
+    std::vector<unsigned char> types;
+    std::vector<int> physicals;
+    std::vector<std::size_t> offsets;
+    std::vector<GridIndex> indices;
+
+    GridIndex size() const {
+        return this->types.size();
+    }
+
+    void resize(GridIndex numberOfRows) {
+        this->types.resize(numberOfRows);
+        this->physicals.resize(numberOfRows);
+    }
+
+    void computeOffsets() {
+        this->offsets.resize(this->types.size() + 1);
+        this->offsets[0] = 0;
+        for (std::size_t i = 0; i < this->types.size(); i++)
+            this->offsets[i+1] = this->offsets[i] + numberOfElementNodes(this->types[i] + 1);
+        this->indices.resize(this->offsets.back());
+    }
+
+    const GridIndex* vertices(GridIndex row) const {
+        return this->indices.data() + this->offsets[row];
+    }
+
+    void clear() {
+        MshConnectivities().swap(*this);
+    }
+
+    void swap(MshConnectivities& other) {
+        this->types.swap(other.types);
+        this->physicals.swap(other.physicals);
+        this->offsets.swap(other.offsets);
+        this->indices.swap(other.indices);
+    }
+};
+
+// Records are one line each in ASCII files and recordSize bytes each in binary files
+inline void splitBlock(std::vector<MshBlock>& blocks, MshBlock block, bool binary, const char*& position, const char* end, int recordsPerBlock = 65536) {
+    int stride = block.physicals ? block.physicals->size() : 1;
+    for (long first = 0; first < block.numberOfRecords; first += recordsPerBlock) {
+        MshBlock chunk = block;
+        chunk.numberOfRecords = std::min<long>(recordsPerBlock, block.numberOfRecords - first);
+        chunk.firstIndex = block.firstIndex + first * stride;
+        chunk.begin = position;
+        if (binary) {
+            if (end - position < long(chunk.numberOfRecords) * block.recordSize)
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Unexpected end of binary data");
+            position += long(chunk.numberOfRecords) * block.recordSize;
+        }
+        else {
+            for (GridIndex i = 0; i < chunk.numberOfRecords; i++) {
+                position = skipBlanks(position, end);
+                if (position == end)
+                    throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - The section ended before the expected number of records");
+                position = skipLine(position, end);
+            }
+        }
+        chunk.end = position;
+        if (stride > 0)
+            blocks.push_back(chunk);
+    }
+}
+
+#endif
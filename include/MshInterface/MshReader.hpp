@@ -1,18 +1,24 @@
 #ifndef MSH_READER_HPP
 #define MSH_READER_HPP
 
-#include <set>
+#include <algorithm>
+#include <cstring>
 #include <string>
-#include <sstream>
-#include <fstream>
 #include <numeric>
+#include <unordered_map>
 #include <BoostInterface/Filesystem.hpp>
+#include <BoostInterface/Iostreams.hpp>
 #include <Grid/GridData.hpp>
+#include <Grid/VertexMarker.hpp>
+#include <MshInterface/MshReader4.hpp>
+#include <MshInterface/DecompressionStream.hpp>
 #include <Utilities/Vector.hpp>
+#include <Utilities/Parse.hpp>
+#include <Utilities/Parallel.hpp>
 
 class MshReader {
     public:
-        MshReader(std::string filePath);
+        MshReader(std::string filePath, int numberOfThreads);
 
         virtual ~MshReader() = default;
 
@@ -20,8 +26,17 @@ class MshReader {
 
     protected:
         void checkFile();
+        void indexSections();
+        void readFormat();
+        const char* findBinarySectionEnd(const std::string& name, const char* position);
+        const char* splitBinaryNodes(const char* position, const char* end, int recordsPerBlock = 65536);
+        const char* splitBinaryElements(const char* position, const char* end, int recordsPerBlock = 65536);
+        const std::vector<MshBlock>& splitNodeBlocks(int recordsPerBlock);
+        void readNodeBlock(const MshBlock& block, std::array<double, 3>* coordinates);
+        const std::vector<MshBlock>& splitElementBlocks(int recordsPerBlock);
+        void readElementBlock(const MshBlock& block, MshConnectivities& rows);
         void readNodes();
-        virtual void readPhysicalEntities() = 0;
+        void readPhysicalEntities();
         void readConnectivities();
         virtual void determineNumberOfFacets() = 0;
         void divideConnectivities();
@@ -30,12 +45,22 @@ class MshReader {
         virtual void addRegions() = 0;
         virtual void addBoundaries() = 0;
         virtual void defineBoundaryVertices() = 0;
+        void releaseConnectivities();
 
         std::string filePath;
-        std::ifstream file;
-        char buffer[800];
-        int numberOfPhysicalEntities, numberOfBoundaries, numberOfRegions, numberOfFacets;
-        std::vector<std::vector<int>> connectivities, elements, facets, regionElements, boundaryFacets;
+        int numberOfThreads;
+        boost::iostreams::mapped_file_source mappedFile;
+        std::string decompressedFile;
+        const char* fileBegin;
+        const char* fileEnd;
+        MshFormat format;
+        boost::shared_ptr<MshReader4> mshReader4;
+        int numberOfPhysicalEntities, numberOfBoundaries, numberOfRegions;
+        GridIndex numberOfElements, numberOfFacets;
+        MshConnectivities connectivities;
+        std::vector<GridIndex> elements, facets, regionOffsets, boundaryOffsets;
+        MshSections sections;
+        std::vector<MshBlock> nodeBlocks, elementBlocks;
 };
 
 #endif
@@ -5,12 +5,11 @@
 
 class MshReader2D : public MshReader {
     public:
-        MshReader2D(std::string filePath);
+        MshReader2D(std::string filePath, int numberOfThreads = defaultNumberOfThreads());
 
         ~MshReader2D() = default;
 
     private:
-        void readPhysicalEntities() override;
         void determineNumberOfFacets() override;
         void addRegions() override;
         void addBoundaries() override;
@@ -5,12 +5,11 @@
 
 class MshReader3D : public MshReader {
     public:
-        MshReader3D(std::string filePath);
+        MshReader3D(std::string filePath, int numberOfThreads = defaultNumberOfThreads());
 
         ~MshReader3D() = default;
 
     private:
-        void readPhysicalEntities() override;
         void determineNumberOfFacets() override;
         void addRegions() override;
         void addBoundaries() override;
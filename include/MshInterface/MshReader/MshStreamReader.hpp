@@ -0,0 +1,37 @@
+#ifndef MSH_STREAM_READER_HPP
+#define MSH_STREAM_READER_HPP
+
+#include <functional>
+#include <Grid/GridStream.hpp>
+#include <MshInterface/MshReader.hpp>
+
+class MshStreamReader : public MshReader, public GridStream {
+    public:
+        MshStreamReader(std::string filePath, int dimension, int chunkSize = 65536, int numberOfThreads = defaultNumberOfThreads());
+
+        ~MshStreamReader() = default;
+
+        boost::shared_ptr<GridData> getGridData() const override;
+        GridIndex getNumberOfVertices() const override;
+        int getSectionElementSize(int section) const override;
+        void streamCoordinates(const std::function<void(const CoordinateChunk&)>& write) override;
+        void streamConnectivities(const std::function<void(const ConnectivityChunk&)>& write) override;
+
+    private:
+        void determineNumberOfFacets() override;
+        void addRegions() override;
+        void addBoundaries() override;
+        void defineBoundaryVertices() override;
+        void forEachElementBlock(const std::function<void(const MshConnectivities&)>& function);
+        bool isFacet(int type) const;
+        bool isElement(int type) const;
+        void mergeElementSize(int& elementSize, int numberOfNodes);
+
+        int chunkSize;
+        GridIndex numberOfVertices;
+        std::vector<GridIndex> physicalCounts, boundaryCounts;
+        std::vector<int> physicalElementSizes, physicalRegions, boundaryElementSizes, sectionElementSizes;
+        std::vector<GridIndex> sectionOffsets;
+};
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef MSH_READER_4_HPP
+#define MSH_READER_4_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <MshInterface/MshFormat.hpp>
+#include <Utilities/Parse.hpp>
+#include <Utilities/Parallel.hpp>
+
+class MshReader4 {
+    public:
+        MshReader4(const MshSections& sections, const MshFormat& format, int numberOfThreads);
+
+        const char* findBinarySectionEnd(const std::string& name, const char* position, const char* end);
+        void readNodes(std::vector<std::array<double, 3>>& coordinates);
+        void readConnectivities(MshConnectivities& connectivities);
+        const std::vector<MshBlock>& splitCoordinates(int recordsPerBlock);
+        void readCoordinates(const MshBlock& block, std::array<double, 3>* coordinates);
+        const std::vector<MshBlock>& splitConnectivities(int recordsPerBlock);
+        void readConnectivities(const MshBlock& block, MshConnectivities& rows);
+
+    private:
+        std::pair<const char*, const char*> findSection(std::string name);
+        int parseInt(const char*& position, const char* end);
+        long parseSize(const char*& position, const char* end);
+        double parseDouble(const char*& position, const char* end);
+        const char* readEntities(const char* position, const char* end);
+        const char* splitNodes(const char* position, const char* end, int recordsPerBlock = 65536);
+        const char* splitElements(const char* position, const char* end, int recordsPerBlock = 65536);
+        void readNodeIndices();
+        void readElementRecords(const MshBlock& block, GridIndex* vertices);
+        GridIndex nodeIndex(long tag);
+
+        const MshSections& sections;
+        const MshFormat& format;
+        int numberOfThreads;
+        GridIndex numberOfVertices, maximumNodeTag, numberOfRows;
+        std::array<std::unordered_map<int, std::vector<int>>, 4> entitiesPhysicals;
+        std::vector<MshBlock> tagBlocks, coordinateBlocks, elementBlocks;
+        std::vector<GridIndex> nodeIndices;
+};
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef BOUNDED_QUEUE_HPP
+#define BOUNDED_QUEUE_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+// Producers block while the queue is full and consumers block while it is empty, until it is closed
+template<class T>
+class BoundedQueue {
+    public:
+        BoundedQueue(std::size_t capacity) : capacity(capacity) {}
+
+        bool push(T value) {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->notFull.wait(lock, [this]() {return this->closed || this->values.size() < this->capacity;});
+            if (this->closed)
+                return false;
+            this->values.push_back(std::move(value));
+            this->notEmpty.notify_one();
+            return true;
+        }
+
+        bool pop(T& value) {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->notEmpty.wait(lock, [this]() {return this->closed || !this->values.empty();});
+            if (this->values.empty())
+                return false;
+            value = std::move(this->values.front());
+            this->values.pop_front();
+            this->notFull.notify_one();
+            return true;
+        }
+
+        void close() {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->closed = true;
+            this->notFull.notify_all();
+            this->notEmpty.notify_all();
+        }
+
+    private:
+        std::size_t capacity;
+        std::deque<T> values;
+        bool closed = false;
+        std::mutex mutex;
+        std::condition_variable notFull, notEmpty;
+};
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef HASH_HPP
+#define HASH_HPP
+
+#include <cstdint>
+#include <cstring>
+
+// 64-bit FNV-1a over 8 byte words, with a shift after every step so the high bits of the words also reach the low bits of the hash
+inline std::uint64_t hashBytes(const char* begin, const char* end, std::uint64_t hash = 14695981039346656037ull) {
+    const std::uint64_t prime = 1099511628211ull;
+    for (; end - begin >= 8; begin += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, begin, 8);
+        hash = (hash ^ word) * prime;
+        hash ^= hash >> 32;
+    }
+    for (; begin != end; begin++)
+        hash = (hash ^ std::uint8_t(*begin)) * prime;
+    return hash;
+}
+
+#endif
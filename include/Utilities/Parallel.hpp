@@ -0,0 +1,127 @@
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Utilities/Parse.hpp>
+
+inline int defaultNumberOfThreads() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+template<class Function>
+void parallelFor(int numberOfTasks, int numberOfThreads, Function&& function) {
+    numberOfThreads = std::max(1, std::min(numberOfThreads, numberOfTasks));
+    if (numberOfThreads == 1) {
+        for (int task = 0; task < numberOfTasks; task++)
+            function(task);
+        return;
+    }
+
+    std::atomic<int> nextTask(0);
+    std::vector<std::exception_ptr> exceptions(numberOfThreads);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < numberOfThreads; thread++)
+        threads.emplace_back([&, thread]() {
+            try {
+                for (int task = nextTask++; task < numberOfTasks; task = nextTask++)
+                    function(task);
+            }
+            catch (...) {
+                exceptions[thread] = std::current_exception();
+                nextTask = numberOfTasks;
+            }
+        });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    for (auto& exception : exceptions)
+        if (exception)
+            std::rethrow_exception(exception);
+}
+
+inline std::vector<const char*> splitLines(const char* begin, const char* end, int numberOfChunks) {
+    std::vector<const char*> bounds{begin};
+    for (int chunk = 1; chunk < numberOfChunks; chunk++) {
+        const char* position = begin + (end - begin) * chunk / numberOfChunks;
+        position = position == begin ? begin : skipLine(position - 1, end);
+        bounds.push_back(std::max(position, bounds.back()));
+    }
+    bounds.push_back(end);
+    return bounds;
+}
+
+// Lines are counted per newline aligned chunk first, so a prefix sum gives every chunk the index of its first line
+template<class Function>
+void forEachLine(const char* begin, const char* end, long numberOfLines, int numberOfThreads, Function&& function) {
+    std::vector<const char*> bounds = splitLines(begin, end, std::max(1, numberOfThreads));
+    int numberOfChunks = bounds.size() - 1;
+
+    std::vector<long> counts(numberOfChunks, 0);
+    parallelFor(numberOfChunks, numberOfThreads, [&](int chunk) {
+        for (const char* position = skipBlanks(bounds[chunk], bounds[chunk+1]); position != bounds[chunk+1]; position = skipBlanks(skipLine(position, bounds[chunk+1]), bounds[chunk+1]))
+            counts[chunk]++;
+    });
+
+    std::vector<long> offsets(numberOfChunks, 0);
+    std::exclusive_scan(counts.cbegin(), counts.cend(), offsets.begin(), 0l);
+    if (offsets.back() + counts.back() != numberOfLines)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Expected " + std::to_string(numberOfLines) + " records and found " + std::to_string(offsets.back() + counts.back()));
+
+    parallelFor(numberOfChunks, numberOfThreads, [&](int chunk) {
+        long index = offsets[chunk];
+        for (const char* position = skipBlanks(bounds[chunk], bounds[chunk+1]); position != bounds[chunk+1]; position = skipBlanks(position, bounds[chunk+1])) {
+            const char* lineEnd = findLineEnd(position, bounds[chunk+1]);
+            function(index++, position, lineEnd);
+            position = lineEnd;
+        }
+    });
+}
+
+// Stable counting sort of the indices [begin, end) by a small non negative key, each chunk scatters into its own slice of every bucket.
+// The sorted indices and the bucket offsets are stored as Index, which must hold end.
+template<class Index, class Key>
+std::vector<Index> countingSort(long begin, long end, int numberOfBuckets, int numberOfThreads, Key&& key, std::vector<Index>& offsets) {
+    long size = std::max(0l, end - begin);
+    int numberOfChunks = std::max(1l, std::min(long(numberOfThreads), size));
+    auto chunkBegin = [&](int chunk) {return begin + size * chunk / numberOfChunks;};
+
+    std::vector<std::vector<Index>> counts(numberOfChunks, std::vector<Index>(numberOfBuckets, 0));
+    parallelFor(numberOfChunks, numberOfThreads, [&](int chunk) {
+        for (long index = chunkBegin(chunk); index < chunkBegin(chunk + 1); index++) {
+            int bucket = key(index);
+            if (bucket < 0 || bucket >= numberOfBuckets)
+                throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Bucket " + std::to_string(bucket) + " is out of range");
+            counts[chunk][bucket]++;
+        }
+    });
+
+    offsets.assign(numberOfBuckets + 1, 0);
+    Index position = 0;
+    for (int bucket = 0; bucket < numberOfBuckets; bucket++) {
+        offsets[bucket] = position;
+        for (int chunk = 0; chunk < numberOfChunks; chunk++) {
+            Index count = counts[chunk][bucket];
+            counts[chunk][bucket] = position;
+            position += count;
+        }
+    }
+    offsets[numberOfBuckets] = position;
+
+    std::vector<Index> sorted(size);
+    parallelFor(numberOfChunks, numberOfThreads, [&](int chunk) {
+        for (long index = chunkBegin(chunk); index < chunkBegin(chunk + 1); index++)
+            sorted[counts[chunk][key(index)]++] = index;
+    });
+    return sorted;
+}
+
+#endif
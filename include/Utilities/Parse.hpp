@@ -0,0 +1,65 @@
+#ifndef PARSE_HPP
+#define PARSE_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+inline bool isBlank(char character) {
+    return character == ' ' || character == '\t' || character == '\r' || character == '\n';
+}
+
+inline const char* skipBlanks(const char* position, const char* end) {
+    while (position != end && isBlank(*position))
+        position++;
+    return position;
+}
+
+inline const char* findLineEnd(const char* position, const char* end) {
+    const char* lineEnd = static_cast<const char*>(std::memchr(position, '\n', end - position));
+    return lineEnd ? lineEnd : end;
+}
+
+inline const char* skipLine(const char* position, const char* end) {
+    const char* lineEnd = findLineEnd(position, end);
+    return lineEnd == end ? end : lineEnd + 1;
+}
+
+template<typename T>
+T parse(const char*& position, const char* end) {
+    position = skipBlanks(position, end);
+    T value;
+    auto result = std::from_chars(position, end, value);
+    if (result.ec != std::errc())
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not parse value at '" + std::string(position, findLineEnd(position, end)) + "'");
+    position = result.ptr;
+    return value;
+}
+
+template<typename T>
+T parseBinary(const char*& position, const char* end, bool swapBytes) {
+    if (end - position < std::ptrdiff_t(sizeof(T)))
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Unexpected end of binary data");
+    T value;
+    char* bytes = reinterpret_cast<char*>(&value);
+    if (swapBytes)
+        std::reverse_copy(position, position + sizeof(T), bytes);
+    else
+        std::memcpy(bytes, position, sizeof(T));
+    position += sizeof(T);
+    return value;
+}
+
+inline std::string parseQuoted(const char*& position, const char* end) {
+    const char* begin = static_cast<const char*>(std::memchr(position, '"', end - position));
+    const char* quoteEnd = begin ? static_cast<const char*>(std::memchr(begin + 1, '"', end - begin - 1)) : nullptr;
+    if (!quoteEnd)
+        throw std::runtime_error(std::string(__PRETTY_FUNCTION__) + " - Could not find a quoted string at '" + std::string(position, findLineEnd(position, end)) + "'");
+    position = quoteEnd + 1;
+    return std::string(begin + 1, quoteEnd);
+}
+
+#endif